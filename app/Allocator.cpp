@@ -0,0 +1,71 @@
+#include "Allocator.hpp"
+#include <utility>
+
+using namespace proj6;
+
+Allocator::Allocator(Strategy strategy, const ParallelOptions &parallel,
+                     const TabuOptions &tabu)
+    : strategy(strategy), parallel(parallel), tabu(tabu), scratch(),
+      colors() {}
+
+const Coloring &Allocator::color(const CSRGraph &ig) {
+  // A chordal graph is colored optimally in linear time, and the check costs
+  // less than either serial engine, so it is always tried first.
+  const bool serial =
+      strategy == Strategy::Dsatur || strategy == Strategy::SmallestLast;
+  if (serial && colorChordal(ig, scratch, colors)) {
+    return colors;
+  }
+
+  switch (strategy) {
+  case Strategy::SmallestLast:
+    colorSmallestLast(ig, scratch, colors);
+    break;
+  case Strategy::JonesPlassmann:
+    colors = colorJonesPlassmann(ig, parallel.num_threads, parallel.seed,
+                                 parallel.stats);
+    break;
+  case Strategy::Speculative:
+    colors = colorSpeculative(ig, parallel.num_threads, parallel.stats);
+    break;
+  case Strategy::Dsatur:
+  default:
+    colorDsatur(ig, scratch, colors);
+    break;
+  }
+
+  if (tabu.enabled) {
+    colors = improveTabu(ig, std::move(colors), tabu.budget, tabu.seed);
+  }
+  return colors;
+}
+
+RegisterAssignment Allocator::assign(const FrozenGraph<Variable> &ig,
+                                     int num_registers,
+                                     Rejection *rejection) {
+  const Rejection rejected = rejectRegisters(ig, num_registers);
+  if (rejection != nullptr) {
+    *rejection = rejected;
+  }
+  if (rejected.bound != Bound::None) {
+    return {};
+  }
+
+  color(ig);
+  if (numRegisters(colors) > num_registers) {
+    return {};
+  }
+
+  RegisterAssignment assignment;
+  assignment.reserve(ig.numVertices());
+  for (CSRGraph::VertexId v = 0; v < ig.numVertices(); v++) {
+    assignment.emplace(ig.name(v), colors[v]);
+  }
+  return assignment;
+}
+
+RegisterAssignment Allocator::assign(const InterferenceGraph<Variable> &ig,
+                                     int num_registers,
+                                     Rejection *rejection) {
+  return assign(ig.freeze(), num_registers, rejection);
+}
@@ -0,0 +1,64 @@
+#ifndef __ALLOCATOR__HPP
+#define __ALLOCATOR__HPP
+
+#include "CSRGraph.hpp"
+#include "Coloring.hpp"
+#include "FrozenGraph.hpp"
+#include "InterferenceGraph.hpp"
+#include "proj6.hpp"
+
+namespace proj6 {
+
+// Allocator
+//
+// A register allocation context for callers that allocate many graphs, or
+// one graph for several register counts. It owns the coloring it returns
+// and the scratch buffers of the serial engines (orderings, register marks,
+// the DSATUR heap and bitsets), and keeps them between calls.
+//
+// With Strategy::Dsatur or Strategy::SmallestLast, the buffers only grow,
+// so color() stops allocating once they are large enough. Which buffers a
+// graph sizes depends on the engine that colors it: a chordal graph only
+// sizes those of colorChordal (see ColoringScratch), so a large chordal
+// graph does not prepare the allocator for a smaller non-chordal one, and
+// a graph that needs more registers can still grow the DSATUR bitsets. The
+// parallel strategies and tabu search still allocate their own working
+// memory, and assign() always allocates the RegisterAssignment it returns.
+class Allocator {
+public:
+  explicit Allocator(Strategy strategy = Strategy::Dsatur,
+                     const ParallelOptions &parallel = {},
+                     const TabuOptions &tabu = {});
+
+  // Colors `ig` with the allocator's strategy, then tabu search if enabled.
+  // With a serial strategy, chordal graphs are colored optimally by
+  // colorChordal instead and tabu search is skipped.
+  // The result is owned by the allocator and overwritten by the next call.
+  const Coloring &color(const CSRGraph &ig);
+
+  // Like assignRegisters: an empty assignment if `num_registers` is not
+  // enough, and `rejection` tells whether a lower bound showed that before
+  // coloring. Unlike it, the whole graph goes to color(), without peeling
+  // low-degree vertices or splitting it into components, so that every
+  // call reuses the allocator's buffers.
+  RegisterAssignment assign(const FrozenGraph<Variable> &ig,
+                            int num_registers,
+                            Rejection *rejection = nullptr);
+
+  // Freezes `ig` first; prefer the overload above when allocating the same
+  // graph more than once.
+  RegisterAssignment assign(const InterferenceGraph<Variable> &ig,
+                            int num_registers,
+                            Rejection *rejection = nullptr);
+
+private:
+  Strategy strategy;
+  ParallelOptions parallel;
+  TabuOptions tabu;
+  ColoringScratch scratch;
+  Coloring colors;
+};
+
+}; // namespace proj6
+
+#endif
@@ -0,0 +1,110 @@
+#include "BitMatrix.hpp"
+#include <algorithm>
+#include <cstddef>
+
+namespace {
+
+const unsigned CACHE_LINE_WORDS = 64 / sizeof(BitMatrix::Word);
+
+// Words in a row of `size` bits, rounded up to whole cache lines.
+unsigned paddedRowWords(unsigned size) {
+  const unsigned words =
+      (size + BitMatrix::WORD_BITS - 1) / BitMatrix::WORD_BITS;
+  return (words + CACHE_LINE_WORDS - 1) / CACHE_LINE_WORDS * CACHE_LINE_WORDS;
+}
+
+} // namespace
+
+BitMatrix::BitMatrix()
+    : num_rows(0), row_words(0), first_word(0), storage({}) {}
+
+BitMatrix::BitMatrix(unsigned size)
+    : num_rows(size), row_words(paddedRowWords(size)), first_word(0),
+      storage({}) {
+  // Over-allocate by one cache line so the first row can be aligned.
+  storage.assign((std::size_t)num_rows * row_words + CACHE_LINE_WORDS, 0);
+  const auto address = reinterpret_cast<std::uintptr_t>(storage.data());
+  const auto misalignment = address % (CACHE_LINE_WORDS * sizeof(Word));
+  if (misalignment != 0) {
+    first_word = (unsigned)((CACHE_LINE_WORDS * sizeof(Word) - misalignment) /
+                            sizeof(Word));
+  }
+}
+
+BitMatrix::BitMatrix(const BitMatrix &other) : BitMatrix(other.num_rows) {
+  std::copy(other.row(0), other.row(0) + (std::size_t)num_rows * row_words,
+            mutableRow(0));
+}
+
+BitMatrix &BitMatrix::operator=(const BitMatrix &other) {
+  if (this != &other) {
+    *this = BitMatrix(other);
+  }
+  return *this;
+}
+
+unsigned BitMatrix::size() const noexcept { return num_rows; }
+
+unsigned BitMatrix::wordsPerRow() const noexcept { return row_words; }
+
+void BitMatrix::set(unsigned row, unsigned column) noexcept {
+  mutableRow(row)[column / WORD_BITS] |= Word(1) << (column % WORD_BITS);
+}
+
+bool BitMatrix::test(unsigned row, unsigned column) const noexcept {
+  return (this->row(row)[column / WORD_BITS] >> (column % WORD_BITS)) & 1;
+}
+
+const BitMatrix::Word *BitMatrix::row(unsigned row) const noexcept {
+  return storage.data() + first_word + (std::size_t)row * row_words;
+}
+
+unsigned BitMatrix::rowCount(unsigned row) const noexcept {
+  return popcount(this->row(row), row_words);
+}
+
+unsigned BitMatrix::intersectionCount(unsigned row,
+                                      unsigned other) const noexcept {
+  const Word *a = this->row(row);
+  const Word *b = this->row(other);
+  unsigned count = 0;
+  for (unsigned i = 0; i < row_words; i++) {
+    count += (unsigned)__builtin_popcountll(a[i] & b[i]);
+  }
+  return count;
+}
+
+void BitMatrix::intersectRows(unsigned row, unsigned other,
+                              Word *out) const noexcept {
+  const Word *a = this->row(row);
+  const Word *b = this->row(other);
+  for (unsigned i = 0; i < row_words; i++) {
+    out[i] = a[i] & b[i];
+  }
+}
+
+void BitMatrix::uniteRows(unsigned row, unsigned other,
+                          Word *out) const noexcept {
+  const Word *a = this->row(row);
+  const Word *b = this->row(other);
+  for (unsigned i = 0; i < row_words; i++) {
+    out[i] = a[i] | b[i];
+  }
+}
+
+unsigned BitMatrix::popcount(const Word *words, unsigned count) noexcept {
+  unsigned total = 0;
+  for (unsigned i = 0; i < count; i++) {
+    total += (unsigned)__builtin_popcountll(words[i]);
+  }
+  return total;
+}
+
+std::size_t BitMatrix::bytesFor(unsigned size) noexcept {
+  return ((std::size_t)size * paddedRowWords(size) + CACHE_LINE_WORDS) *
+         sizeof(Word);
+}
+
+BitMatrix::Word *BitMatrix::mutableRow(unsigned row) noexcept {
+  return storage.data() + first_word + (std::size_t)row * row_words;
+}
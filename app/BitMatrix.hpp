@@ -0,0 +1,90 @@
+#ifndef __BIT_MATRIX__HPP
+#define __BIT_MATRIX__HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// BitMatrix
+//
+// A square matrix of bits stored row by row. Each row is padded to a whole
+// number of 64-byte cache lines and starts on a cache line boundary, so row
+// operations (popcount, AND, OR) run over contiguous, aligned words that the
+// compiler can vectorize.
+//
+// Used as the adjacency matrix of dense interference graphs: testing an edge
+// is a single bit test and a degree is a popcount over one row.
+class BitMatrix {
+public:
+  using Word = std::uint64_t;
+
+  static constexpr unsigned WORD_BITS = 64;
+
+  BitMatrix();
+
+  explicit BitMatrix(unsigned size);
+
+  // Copies re-align the rows in their own storage.
+  BitMatrix(const BitMatrix &other);
+
+  BitMatrix(BitMatrix &&other) = default;
+
+  BitMatrix &operator=(const BitMatrix &other);
+
+  BitMatrix &operator=(BitMatrix &&other) = default;
+
+  unsigned size() const noexcept;
+
+  // Number of words in each (padded) row.
+  unsigned wordsPerRow() const noexcept;
+
+  void set(unsigned row, unsigned column) noexcept;
+
+  bool test(unsigned row, unsigned column) const noexcept;
+
+  const Word *row(unsigned row) const noexcept;
+
+  // Number of set bits in `row`.
+  unsigned rowCount(unsigned row) const noexcept;
+
+  // Number of columns set in both `row` and `other`.
+  unsigned intersectionCount(unsigned row, unsigned other) const noexcept;
+
+  // Writes `row` AND `other` (resp. OR) into `out`, which must hold
+  // wordsPerRow() words.
+  void intersectRows(unsigned row, unsigned other, Word *out) const noexcept;
+
+  void uniteRows(unsigned row, unsigned other, Word *out) const noexcept;
+
+  // Calls `visit` with every set column of `row` in ascending order.
+  template <typename F> void forEachInRow(unsigned row, F &&visit) const;
+
+  static unsigned popcount(const Word *words, unsigned count) noexcept;
+
+  // Bytes a BitMatrix of `size` rows allocates, padding and alignment slack
+  // included.
+  static std::size_t bytesFor(unsigned size) noexcept;
+
+private:
+  unsigned num_rows;
+  unsigned row_words;
+  // Index of the first cache-line aligned word in `storage`.
+  unsigned first_word;
+  std::vector<Word> storage;
+
+  Word *mutableRow(unsigned row) noexcept;
+};
+
+template <typename F>
+void BitMatrix::forEachInRow(unsigned row_index, F &&visit) const {
+  const Word *words = row(row_index);
+  for (unsigned i = 0; i < row_words; i++) {
+    Word word = words[i];
+    while (word != 0) {
+      visit(i * WORD_BITS + (unsigned)__builtin_ctzll(word));
+      word &= word - 1;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,261 @@
+#include "Coloring.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace proj6;
+
+using VertexId = CSRGraph::VertexId;
+
+std::vector<VertexId> proj6::greedyClique(const CSRGraph &ig,
+                                          unsigned stop_size) {
+  const unsigned n = ig.numVertices();
+  std::vector<VertexId> by_degree(n);
+  for (VertexId v = 0; v < n; v++) {
+    by_degree[v] = v;
+  }
+  std::stable_sort(by_degree.begin(), by_degree.end(),
+                   [&](VertexId v, VertexId w) {
+                     return ig.degree(v) > ig.degree(w);
+                   });
+
+  std::vector<VertexId> best, clique, candidates;
+  for (const VertexId v : by_degree) {
+    // A clique through v has at most degree(v) + 1 vertices, and the
+    // vertices come in decreasing degree, so nothing later can do better.
+    if (ig.degree(v) + 1 <= best.size()) {
+      break;
+    }
+
+    candidates.clear();
+    ig.forEachNeighbor(v, [&](VertexId w) {
+      if (ig.degree(w) >= best.size()) {
+        candidates.push_back(w);
+      }
+    });
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [&](VertexId w, VertexId u) {
+                       return ig.degree(w) > ig.degree(u);
+                     });
+
+    clique.assign(1, v);
+    for (const VertexId w : candidates) {
+      if (std::all_of(clique.begin(), clique.end(),
+                      [&](VertexId u) { return ig.interferes(u, w); })) {
+        clique.push_back(w);
+      }
+    }
+    if (clique.size() > best.size()) {
+      best = clique;
+    }
+    if (best.size() >= stop_size) {
+      break;
+    }
+  }
+
+  return best;
+}
+
+namespace {
+
+// Depth-first DSATUR search for a coloring with fewer registers than the
+// best one found so far.
+//
+// For every vertex the number of colored neighbors holding each register is
+// counted, and the registers with a nonzero count are mirrored in a bitset,
+// so assigning or undoing a register costs O(degree) and the free registers
+// of a vertex are read a word at a time.
+class BranchAndBound {
+public:
+  BranchAndBound(const CSRGraph &ig, Coloring initial,
+                 const std::vector<VertexId> &clique,
+                 const SearchBudget &budget,
+                 std::chrono::steady_clock::time_point start)
+      : ig(ig), n(ig.numVertices()), best(std::move(initial)),
+        best_count(numRegisters(best)), lower_bound((Register)clique.size()),
+        max_register(best_count), words((best_count + 64) / 64),
+        colors(n, 0), neighbor_count((std::size_t)n * (max_register + 1), 0),
+        taken((std::size_t)n * words, 0), saturation(n, 0),
+        uncolored_degree(n), num_colored(0), budget(budget), nodes(0),
+        exhausted(false), deadline(start + budget.time_limit),
+        clock_interval(std::max(1u, 65536 / std::max(1u, n))) {
+    for (VertexId v = 0; v < n; v++) {
+      uncolored_degree[v] = ig.degree(v);
+    }
+    // Any optimal coloring can be relabeled to give the clique registers
+    // 1..|clique|, so fixing them loses nothing and removes symmetric
+    // branches.
+    for (unsigned i = 0; i < clique.size(); i++) {
+      assign(clique[i], (Register)i + 1);
+    }
+  }
+
+  // Runs until the best coloring is proven optimal or the budget runs out.
+  void run() {
+    struct Frame {
+      VertexId vertex;
+      // Next register to try for `vertex`.
+      Register next;
+      // Registers in use before `vertex` was colored.
+      Register used;
+    };
+    std::vector<Frame> stack;
+    Register used = lower_bound;
+
+    while (best_count > lower_bound) {
+      if (num_colored == n) {
+        if (used < best_count) {
+          best = colors;
+          best_count = used;
+        }
+      } else if (!spend()) {
+        exhausted = true;
+        return;
+      } else {
+        stack.push_back({select(), 1, used});
+      }
+
+      // Advance the deepest frame that still has a register to try.
+      bool advanced = false;
+      while (!stack.empty() && !advanced) {
+        Frame &frame = stack.back();
+        if (colors[frame.vertex] != 0) {
+          unassign(frame.vertex);
+        }
+        // Every completion below a frame that already uses best_count
+        // registers uses at least as many, so none of them can improve.
+        if (frame.used >= best_count) {
+          stack.pop_back();
+          continue;
+        }
+
+        const Register limit = std::min(frame.used + 1, best_count - 1);
+        for (Register reg = frame.next; reg <= limit; reg++) {
+          if (!isTaken(frame.vertex, reg)) {
+            frame.next = reg + 1;
+            assign(frame.vertex, reg);
+            used = std::max(frame.used, reg);
+            advanced = true;
+            break;
+          }
+        }
+        if (!advanced) {
+          stack.pop_back();
+        }
+      }
+      if (!advanced) {
+        return;
+      }
+    }
+  }
+
+  ExactColoring result() {
+    return {std::move(best), (unsigned)lower_bound, !exhausted, nodes};
+  }
+
+private:
+  const CSRGraph &ig;
+  const unsigned n;
+  Coloring best;
+  Register best_count;
+  const Register lower_bound;
+  const Register max_register;
+  const unsigned words;
+
+  Coloring colors;
+  std::vector<unsigned> neighbor_count;
+  std::vector<std::uint64_t> taken;
+  std::vector<unsigned> saturation;
+  std::vector<unsigned> uncolored_degree;
+  unsigned num_colored;
+
+  const SearchBudget &budget;
+  unsigned long nodes;
+  bool exhausted;
+  const std::chrono::steady_clock::time_point deadline;
+  const unsigned clock_interval;
+
+  bool isTaken(VertexId v, Register reg) const noexcept {
+    return (taken[(std::size_t)v * words + reg / 64] >> (reg % 64)) & 1;
+  }
+
+  void assign(VertexId v, Register reg) {
+    colors[v] = reg;
+    num_colored++;
+    ig.forEachNeighbor(v, [&](VertexId w) {
+      uncolored_degree[w]--;
+      if (neighbor_count[(std::size_t)w * (max_register + 1) + reg]++ == 0) {
+        taken[(std::size_t)w * words + reg / 64] |= std::uint64_t(1)
+                                                    << (reg % 64);
+        saturation[w]++;
+      }
+    });
+  }
+
+  void unassign(VertexId v) {
+    const Register reg = colors[v];
+    colors[v] = 0;
+    num_colored--;
+    ig.forEachNeighbor(v, [&](VertexId w) {
+      uncolored_degree[w]++;
+      if (--neighbor_count[(std::size_t)w * (max_register + 1) + reg] == 0) {
+        taken[(std::size_t)w * words + reg / 64] &=
+            ~(std::uint64_t(1) << (reg % 64));
+        saturation[w]--;
+      }
+    });
+  }
+
+  // The uncolored vertex with the highest saturation, then the highest
+  // degree among uncolored vertices.
+  VertexId select() const noexcept {
+    VertexId chosen = n;
+    for (VertexId v = 0; v < n; v++) {
+      if (colors[v] != 0) {
+        continue;
+      }
+      if (chosen == n || saturation[v] > saturation[chosen] ||
+          (saturation[v] == saturation[chosen] &&
+           uncolored_degree[v] > uncolored_degree[chosen])) {
+        chosen = v;
+      }
+    }
+    return chosen;
+  }
+
+  // Counts a search node; false once the node or time budget is used up.
+  // Every node scans all vertices in select(), so the clock is read about
+  // once per 64K vertices scanned.
+  bool spend() {
+    nodes++;
+    if (budget.node_limit != 0 && nodes > budget.node_limit) {
+      return false;
+    }
+    return budget.time_limit.count() == 0 || nodes % clock_interval != 0 ||
+           std::chrono::steady_clock::now() < deadline;
+  }
+};
+
+}; // namespace
+
+ExactColoring proj6::colorExact(const CSRGraph &ig,
+                                const SearchBudget &budget) {
+  // The bounds count against the time budget too.
+  const auto start = std::chrono::steady_clock::now();
+  const auto clique = greedyClique(ig);
+  BranchAndBound search(ig, colorDsatur(ig), clique, budget, start);
+  search.run();
+  return search.result();
+}
+
+ExactColoring proj6::colorExact(const CSRGraph &ig, Coloring initial,
+                                const std::vector<VertexId> &clique,
+                                const SearchBudget &budget) {
+  BranchAndBound search(ig, std::move(initial), clique, budget,
+                        std::chrono::steady_clock::now());
+  search.run();
+  return search.result();
+}
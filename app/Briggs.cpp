@@ -0,0 +1,131 @@
+#include "Coloring.hpp"
+#include <algorithm>
+#include <queue>
+#include <utility>
+#include <vector>
+
+using namespace proj6;
+
+using VertexId = CSRGraph::VertexId;
+
+namespace {
+
+enum class Worklist { Low, High, Removed };
+
+// A spill candidate as it was when queued. Entries go stale when the
+// vertex's degree changes or it is removed; they are skipped when popped.
+struct SpillCandidate {
+  double priority;
+  unsigned degree;
+  VertexId vertex;
+
+  // Orders the queue so the lowest cost per remaining edge comes out first,
+  // and the lowest ID among equals.
+  bool operator<(const SpillCandidate &other) const noexcept {
+    if (priority != other.priority) {
+      return priority > other.priority;
+    }
+    return vertex > other.vertex;
+  }
+};
+
+}; // namespace
+
+Coloring proj6::colorBriggs(const CSRGraph &ig, int num_registers,
+                            const std::vector<double> &spill_costs) {
+  const unsigned n = ig.numVertices();
+  const unsigned k = num_registers < 0 ? 0 : (unsigned)num_registers;
+
+  std::vector<unsigned> degree(n);
+  std::vector<Worklist> worklist(n);
+  std::vector<VertexId> low;
+  std::priority_queue<SpillCandidate> high;
+
+  auto cost = [&](VertexId v) {
+    return spill_costs.empty() ? 1.0 : spill_costs[v];
+  };
+  // With no registers even isolated vertices are spill candidates; dividing
+  // by a zero degree would give NaN for a zero cost and break the ordering.
+  auto queueHigh = [&](VertexId v) {
+    high.push({cost(v) / std::max(degree[v], 1u), degree[v], v});
+  };
+
+  for (VertexId v = 0; v < n; v++) {
+    degree[v] = ig.degree(v);
+    if (degree[v] < k) {
+      worklist[v] = Worklist::Low;
+      low.push_back(v);
+    } else {
+      worklist[v] = Worklist::High;
+      queueHigh(v);
+    }
+  }
+
+  // Simplify: remove vertices of degree < k, which can always be colored
+  // once their neighbors are. When none are left, optimistically remove the
+  // cheapest spill candidate as well and hope its neighbors share registers.
+  std::vector<VertexId> select_stack;
+  select_stack.reserve(n);
+
+  auto remove = [&](VertexId v) {
+    worklist[v] = Worklist::Removed;
+    select_stack.push_back(v);
+
+    ig.forEachNeighbor(v, [&](VertexId u) {
+      if (worklist[u] == Worklist::Removed) {
+        return;
+      }
+      degree[u]--;
+      if (worklist[u] != Worklist::High) {
+        return;
+      }
+      if (degree[u] < k) {
+        worklist[u] = Worklist::Low;
+        low.push_back(u);
+      } else {
+        queueHigh(u);
+      }
+    });
+  };
+
+  while (select_stack.size() < n) {
+    if (!low.empty()) {
+      const VertexId v = low.back();
+      low.pop_back();
+      remove(v);
+      continue;
+    }
+
+    const SpillCandidate candidate = high.top();
+    high.pop();
+    if (worklist[candidate.vertex] == Worklist::High &&
+        degree[candidate.vertex] == candidate.degree) {
+      remove(candidate.vertex);
+    }
+  }
+
+  // Select: color in reverse removal order. A vertex whose neighbors already
+  // hold all k registers is spilled and keeps register 0.
+  Coloring colors(n, 0);
+  std::vector<VertexId> forbidden(k + 1, n);
+
+  while (!select_stack.empty()) {
+    const VertexId v = select_stack.back();
+    select_stack.pop_back();
+
+    ig.forEachNeighbor(v, [&](VertexId w) {
+      if (colors[w] != 0) {
+        forbidden[colors[w]] = v;
+      }
+    });
+
+    for (unsigned reg = 1; reg <= k; reg++) {
+      if (forbidden[reg] != v) {
+        colors[v] = (Register)reg;
+        break;
+      }
+    }
+  }
+
+  return colors;
+}
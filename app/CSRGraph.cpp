@@ -0,0 +1,66 @@
+#include "CSRGraph.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+CSRGraph::CSRGraph()
+    : offsets({0}), adjacency({}), bits(), storage(Layout::Sparse),
+      max_degree(0) {}
+
+CSRGraph::CSRGraph(std::vector<unsigned> offsets,
+                   std::vector<VertexId> adjacency)
+    : offsets(std::move(offsets)), adjacency(std::move(adjacency)), bits(),
+      storage(Layout::Sparse), max_degree(0) {
+  for (VertexId v = 0; v < numVertices(); v++) {
+    max_degree = std::max(max_degree, degree(v));
+  }
+}
+
+CSRGraph::CSRGraph(BitMatrix matrix)
+    : offsets({0}), adjacency({}), bits(std::move(matrix)),
+      storage(Layout::Dense), max_degree(0) {
+  offsets.reserve(bits.size() + 1);
+  for (VertexId v = 0; v < bits.size(); v++) {
+    offsets.push_back(offsets.back() + bits.rowCount(v));
+    max_degree = std::max(max_degree, offsets[v + 1] - offsets[v]);
+  }
+}
+
+CSRGraph::Layout CSRGraph::preferredLayout(unsigned num_vertices,
+                                           unsigned num_edges) noexcept {
+  const std::size_t matrix_bytes = BitMatrix::bytesFor(num_vertices);
+  const std::size_t csr_bytes = 2 * (std::size_t)num_edges * sizeof(VertexId);
+
+  return matrix_bytes <= csr_bytes ? Layout::Dense : Layout::Sparse;
+}
+
+CSRGraph::Layout CSRGraph::layout() const noexcept { return storage; }
+
+unsigned CSRGraph::numVertices() const noexcept {
+  return (unsigned)offsets.size() - 1;
+}
+
+unsigned CSRGraph::numEdges() const noexcept { return offsets.back() / 2; }
+
+unsigned CSRGraph::degree(VertexId v) const noexcept {
+  return offsets[v + 1] - offsets[v];
+}
+
+unsigned CSRGraph::maxDegree() const noexcept { return max_degree; }
+
+bool CSRGraph::interferes(VertexId v, VertexId w) const noexcept {
+  if (storage == Layout::Dense) {
+    return bits.test(v, w);
+  }
+
+  // Search the shorter of the two sorted neighbor lists.
+  if (degree(w) < degree(v)) {
+    std::swap(v, w);
+  }
+  return std::binary_search(adjacency.begin() + offsets[v],
+                            adjacency.begin() + offsets[v + 1], w);
+}
+
+const BitMatrix *CSRGraph::matrix() const noexcept {
+  return storage == Layout::Dense ? &bits : nullptr;
+}
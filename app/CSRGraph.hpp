@@ -0,0 +1,79 @@
+#ifndef __CSR_GRAPH__HPP
+#define __CSR_GRAPH__HPP
+
+#include "BitMatrix.hpp"
+#include <vector>
+
+// CSRGraph
+//
+// An immutable interference graph over the dense vertex IDs [0, n). Sparse
+// graphs are stored in compressed sparse row form: the neighbors of vertex v
+// are the contiguous slice adjacency[offsets[v], offsets[v + 1]), sorted in
+// ascending order, with every undirected edge stored once in each direction.
+// Dense graphs are instead stored as a BitMatrix, which is far smaller than
+// the CSR arrays once a sizable fraction of all vertex pairs interfere. In
+// both layouts offsets[v + 1] - offsets[v] is the degree of v.
+//
+// This is the layout the register allocators iterate over. It never changes
+// after construction, so it can be shared freely between passes.
+class CSRGraph {
+public:
+  using VertexId = unsigned;
+
+  enum class Layout { Auto, Sparse, Dense };
+
+  CSRGraph();
+
+  // Sparse layout. `offsets` must hold n + 1 entries and each neighbor slice
+  // of `adjacency` must be sorted.
+  CSRGraph(std::vector<unsigned> offsets, std::vector<VertexId> adjacency);
+
+  // Dense layout. `matrix` must be symmetric with an empty diagonal.
+  explicit CSRGraph(BitMatrix matrix);
+
+  // The layout that Layout::Auto resolves to for a graph of this size: dense
+  // once the bit matrix is no larger than the CSR neighbor array.
+  static Layout preferredLayout(unsigned num_vertices,
+                                unsigned num_edges) noexcept;
+
+  Layout layout() const noexcept;
+
+  unsigned numVertices() const noexcept;
+
+  unsigned numEdges() const noexcept;
+
+  unsigned degree(VertexId v) const noexcept;
+
+  // O(1).
+  unsigned maxDegree() const noexcept;
+
+  bool interferes(VertexId v, VertexId w) const noexcept;
+
+  // Calls `visit` with every neighbor of `v` in ascending order.
+  template <typename F> void forEachNeighbor(VertexId v, F &&visit) const;
+
+  // The adjacency matrix, or nullptr for the sparse layout.
+  const BitMatrix *matrix() const noexcept;
+
+protected:
+  std::vector<unsigned> offsets;
+  std::vector<VertexId> adjacency;
+  BitMatrix bits;
+  Layout storage;
+  // Computed once at construction; every allocator asks for it.
+  unsigned max_degree;
+};
+
+template <typename F>
+void CSRGraph::forEachNeighbor(VertexId v, F &&visit) const {
+  if (storage == Layout::Dense) {
+    bits.forEachInRow(v, visit);
+    return;
+  }
+
+  for (unsigned i = offsets[v]; i < offsets[v + 1]; i++) {
+    visit(adjacency[i]);
+  }
+}
+
+#endif
@@ -10,11 +10,14 @@
 #ifndef CSV_READER_H
 #define CSV_READER_H
 
+#include "EdgeSource.hpp"
 #include "InterferenceGraph.hpp"
+#include "SymbolTable.hpp"
 #include "proj6.hpp"
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 using namespace proj6;
 
@@ -31,8 +34,43 @@ public:
   //
   // This function iterates through the file at `graph_path`
   // line by line, adding each edge to this InterferenceGraph.
-  // See the README for an example.
+  // See the README for an example. The file is memory-mapped and
+  // tokenized in place; rows are split exactly as readRow splits them.
   static InterferenceGraph<Variable> load(const std::string &graph_path);
+
+  // Same as above, but interns every vertex in `symbols` and builds the
+  // graph over symbols instead of names.
+  static InterferenceGraph<Symbol> load(const std::string &graph_path,
+                                        SymbolTable &symbols);
+
+  // Multi-threaded version of the above using `num_threads` threads (0 for
+  // one per hardware thread). The vertices, symbols, edge count and errors
+  // are the same as for the serial loader.
+  static InterferenceGraph<Symbol> load(const std::string &graph_path,
+                                        SymbolTable &symbols,
+                                        unsigned num_threads);
+
+  // Builds a graph from any edge source, such as a CSVEdgeSource or an
+  // IGBinaryReader.
+  static InterferenceGraph<Symbol> load(EdgeSource &source,
+                                        SymbolTable &symbols);
+};
+
+// CSVEdgeSource
+//
+// Streams a CSV graph file row by row: a vertex event for every cell, then
+// an edge event if the row has two cells. The file is mapped rather than
+// read into memory, so streaming needs no memory proportional to its size.
+class CSVEdgeSource : public EdgeSource {
+public:
+  explicit CSVEdgeSource(const std::string &graph_path);
+
+  // Throws std::runtime_error if the file does not exist or has a row with
+  // more than two cells, like CSVReader::load.
+  void stream(EdgeSink &sink) override;
+
+private:
+  std::string graph_path;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "Coloring.hpp"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using namespace proj6;
+
+using VertexId = CSRGraph::VertexId;
+
+std::vector<VertexId> proj6::maximumCardinalityOrder(const CSRGraph &ig) {
+  ColoringScratch scratch;
+  maximumCardinalityOrder(ig, scratch);
+  return std::move(scratch.order);
+}
+
+void proj6::maximumCardinalityOrder(const CSRGraph &ig,
+                                    ColoringScratch &scratch) {
+  const unsigned n = ig.numVertices();
+
+  // The unvisited vertices order[i..n) sorted by weight, the number of
+  // visited neighbors, highest first. Bucket w spans
+  // [bucket_start[w], bucket_start[w - 1]), bucket 0 ending at n, and
+  // position[v] is the index of v. Weights only ever go up by one, so a
+  // vertex moves to the front of its bucket and the boundary shifts past
+  // it, as in smallestLastOrder with the direction reversed.
+  std::vector<unsigned> &weight = scratch.degrees;
+  std::vector<unsigned> &bucket_start = scratch.buckets;
+  std::vector<unsigned> &position = scratch.positions;
+  std::vector<VertexId> &order = scratch.order;
+  weight.assign(n, 0);
+  bucket_start.assign(ig.maxDegree() + 2, 0);
+  position.resize(n);
+  order.resize(n);
+  for (VertexId v = 0; v < n; v++) {
+    order[v] = v;
+    position[v] = v;
+  }
+
+  unsigned max_weight = 0;
+  for (unsigned i = 0; i < n; i++) {
+    // Buckets above max_weight are empty and start at i.
+    while (max_weight > 0 &&
+           bucket_start[max_weight] == bucket_start[max_weight - 1]) {
+      max_weight--;
+    }
+    const VertexId v = order[i];
+    bucket_start[max_weight]++;
+    // A neighbor can reach max_weight + 1 now, so that bucket has to start
+    // right after v.
+    bucket_start[max_weight + 1] = i + 1;
+
+    ig.forEachNeighbor(v, [&](VertexId u) {
+      if (position[u] <= i) {
+        return;
+      }
+      const unsigned w = weight[u];
+      const unsigned front = bucket_start[w];
+      const VertexId x = order[front];
+      if (u != x) {
+        std::swap(order[front], order[position[u]]);
+        std::swap(position[u], position[x]);
+      }
+      bucket_start[w]++;
+      weight[u]++;
+    });
+    if (bucket_start[max_weight + 1] != bucket_start[max_weight]) {
+      max_weight++;
+    }
+  }
+}
+
+bool proj6::colorChordal(const CSRGraph &ig, Coloring &colors) {
+  ColoringScratch scratch;
+  return colorChordal(ig, scratch, colors);
+}
+
+bool proj6::colorChordal(const CSRGraph &ig, ColoringScratch &scratch,
+                         Coloring &colors) {
+  const unsigned n = ig.numVertices();
+  maximumCardinalityOrder(ig, scratch);
+  const std::vector<VertexId> &order = scratch.order;
+  const std::vector<unsigned> &position = scratch.positions;
+
+  // Tarjan and Yannakakis' test that the reverse of the visit order is a
+  // perfect elimination ordering. In elimination order, the parent of v is
+  // its first neighbor eliminated after it, and every other neighbor after
+  // v must also be a neighbor of the parent. Seen from w: each earlier
+  // neighbor v of w must have its parent marked as adjacent to w, or be w.
+  std::vector<VertexId> &parent = scratch.marks;
+  std::vector<unsigned> &marked_by = scratch.degrees;
+  parent.resize(n);
+  marked_by.resize(n);
+  for (unsigned i = n; i-- > 0;) {
+    const VertexId w = order[i];
+    parent[w] = w;
+    marked_by[w] = i;
+    ig.forEachNeighbor(w, [&](VertexId v) {
+      if (position[v] > i) {
+        marked_by[v] = i;
+        if (parent[v] == v) {
+          parent[v] = w;
+        }
+      }
+    });
+
+    bool perfect = true;
+    ig.forEachNeighbor(w, [&](VertexId v) {
+      perfect = perfect && (position[v] < i || marked_by[parent[v]] == i);
+    });
+    if (!perfect) {
+      return false;
+    }
+  }
+
+  // The neighbors of each vertex visited before it form a clique, so greedy
+  // in visit order uses exactly as many registers as the largest clique.
+  greedyColor(ig, order, scratch, colors);
+  return true;
+}
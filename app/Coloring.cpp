@@ -0,0 +1,127 @@
+#include "Coloring.hpp"
+#include <algorithm>
+#include <utility>
+
+using namespace proj6;
+
+using VertexId = CSRGraph::VertexId;
+
+Register proj6::numRegisters(const Coloring &colors) noexcept {
+  return colors.empty() ? 0 : *std::max_element(colors.begin(), colors.end());
+}
+
+std::vector<VertexId> proj6::smallestLastOrder(const CSRGraph &ig,
+                                               unsigned *degeneracy) {
+  ColoringScratch scratch;
+  smallestLastOrder(ig, scratch, degeneracy);
+  return std::move(scratch.order);
+}
+
+void proj6::smallestLastOrder(const CSRGraph &ig, ColoringScratch &scratch,
+                              unsigned *degeneracy) {
+  const unsigned n = ig.numVertices();
+  const unsigned max_degree = ig.maxDegree();
+
+  // Vertices sorted by remaining degree. bucket_start[d] is the index in
+  // `order` of the first vertex of remaining degree d and position[v] is the
+  // index of v. Everything before the current index has been removed.
+  std::vector<unsigned> &remaining = scratch.degrees;
+  std::vector<unsigned> &bucket_start = scratch.buckets;
+  std::vector<unsigned> &position = scratch.positions;
+  std::vector<VertexId> &order = scratch.order;
+  remaining.resize(n);
+  bucket_start.assign(max_degree + 2, 0);
+  position.resize(n);
+  order.resize(n);
+
+  for (VertexId v = 0; v < n; v++) {
+    remaining[v] = ig.degree(v);
+    bucket_start[remaining[v] + 1]++;
+  }
+  for (unsigned d = 1; d < bucket_start.size(); d++) {
+    bucket_start[d] += bucket_start[d - 1];
+  }
+  for (VertexId v = 0; v < n; v++) {
+    position[v] = bucket_start[remaining[v]]++;
+    order[position[v]] = v;
+  }
+  for (unsigned d = (unsigned)bucket_start.size() - 1; d > 0; d--) {
+    bucket_start[d] = bucket_start[d - 1];
+  }
+  bucket_start[0] = 0;
+
+  unsigned max_removed = 0;
+  for (unsigned i = 0; i < n; i++) {
+    const VertexId v = order[i];
+    max_removed = std::max(max_removed, remaining[v]);
+
+    ig.forEachNeighbor(v, [&](VertexId u) {
+      if (remaining[u] <= remaining[v]) {
+        // Already removed, or in the same bucket and never ahead of v.
+        return;
+      }
+
+      // Move u to the front of its bucket, then shift the bucket boundary
+      // past it so it lands in the bucket below.
+      const unsigned degree = remaining[u];
+      const unsigned front = bucket_start[degree];
+      const VertexId w = order[front];
+      if (u != w) {
+        std::swap(order[front], order[position[u]]);
+        std::swap(position[u], position[w]);
+      }
+      bucket_start[degree]++;
+      remaining[u]--;
+    });
+  }
+
+  if (degeneracy != nullptr) {
+    *degeneracy = max_removed;
+  }
+}
+
+Coloring proj6::greedyColor(const CSRGraph &ig,
+                            const std::vector<VertexId> &order) {
+  ColoringScratch scratch;
+  Coloring colors;
+  greedyColor(ig, order, scratch, colors);
+  return colors;
+}
+
+void proj6::greedyColor(const CSRGraph &ig,
+                        const std::vector<VertexId> &order,
+                        ColoringScratch &scratch, Coloring &colors) {
+  const VertexId NONE = ig.numVertices();
+  colors.assign(ig.numVertices(), 0);
+  // forbidden[r] == v while coloring v means a neighbor of v holds r.
+  std::vector<VertexId> &forbidden = scratch.marks;
+  forbidden.assign(ig.maxDegree() + 2, NONE);
+
+  for (const VertexId v : order) {
+    ig.forEachNeighbor(v, [&](VertexId w) {
+      if (colors[w] != 0) {
+        forbidden[colors[w]] = v;
+      }
+    });
+
+    Register reg = 1;
+    while (forbidden[reg] == v) {
+      reg++;
+    }
+    colors[v] = reg;
+  }
+}
+
+Coloring proj6::colorSmallestLast(const CSRGraph &ig) {
+  ColoringScratch scratch;
+  Coloring colors;
+  colorSmallestLast(ig, scratch, colors);
+  return colors;
+}
+
+void proj6::colorSmallestLast(const CSRGraph &ig, ColoringScratch &scratch,
+                              Coloring &colors) {
+  smallestLastOrder(ig, scratch);
+  std::reverse(scratch.order.begin(), scratch.order.end());
+  greedyColor(ig, scratch.order, scratch, colors);
+}
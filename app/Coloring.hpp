@@ -0,0 +1,295 @@
+#ifndef __COLORING__HPP
+#define __COLORING__HPP
+
+#include "CSRGraph.hpp"
+#include "ThreadPool.hpp"
+#include "proj6.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace proj6 {
+
+// Register of each vertex ID of a CSRGraph. 0 means the vertex has not been
+// assigned a register.
+using Coloring = std::vector<Register>;
+
+// Highest register used by `colors`, or 0 if it is empty.
+Register numRegisters(const Coloring &colors) noexcept;
+
+// ColoringScratch
+//
+// Working memory for the serial engines (smallest-last, greedy, DSATUR,
+// chordal).
+// Every overload that takes one writes into these buffers instead of
+// allocating its own, and a vector keeps its capacity, so running an engine
+// again on a graph no larger than before allocates nothing. The engines
+// size different buffers, though, and DSATUR's bitsets grow with the number
+// of registers too, so one engine's run does not size the scratch for
+// another. See Allocator.
+struct ColoringScratch {
+  // Vertex orderings and the DSATUR heap.
+  std::vector<CSRGraph::VertexId> order;
+  // Per-register marks for greedy coloring, or per-vertex parents.
+  std::vector<CSRGraph::VertexId> marks;
+  // Remaining or uncolored degree of each vertex, or its search weight.
+  std::vector<unsigned> degrees;
+  // Buckets of the smallest-last and maximum cardinality queues.
+  std::vector<unsigned> buckets;
+  // Position of each vertex in `order`.
+  std::vector<unsigned> positions;
+  // DSATUR saturation of each vertex and its bitsets of neighbor registers.
+  std::vector<unsigned> saturation;
+  std::vector<std::uint64_t> bits;
+};
+
+// smallestLastOrder
+//
+// Repeatedly removes a vertex of minimum remaining degree and returns the
+// vertices in the order they were removed. A bucket queue keyed by remaining
+// degree makes this O(V + E). If `degeneracy` is given it receives the
+// largest remaining degree seen at removal, the graph's degeneracy.
+std::vector<CSRGraph::VertexId> smallestLastOrder(const CSRGraph &ig,
+                                                  unsigned *degeneracy =
+                                                      nullptr);
+
+// Same as above, leaving the order in `scratch.order`.
+void smallestLastOrder(const CSRGraph &ig, ColoringScratch &scratch,
+                       unsigned *degeneracy = nullptr);
+
+// greedyColor
+//
+// Gives each vertex of `order`, in turn, the lowest register not used by any
+// of its already colored neighbors. The registers seen around a vertex are
+// marked in a per-register array stamped with the current vertex, so each
+// vertex costs O(degree) and the whole pass O(V + E). Never uses more than
+// maxDegree() + 1 registers.
+Coloring greedyColor(const CSRGraph &ig,
+                     const std::vector<CSRGraph::VertexId> &order);
+
+// Same as above, writing into `colors`. `order` may be `scratch.order`.
+void greedyColor(const CSRGraph &ig,
+                 const std::vector<CSRGraph::VertexId> &order,
+                 ColoringScratch &scratch, Coloring &colors);
+
+// colorSmallestLast
+//
+// greedyColor over the reverse of smallestLastOrder. Each vertex has at most
+// `degeneracy` colored neighbors when it is colored, so at most
+// degeneracy + 1 <= maxDegree() + 1 registers are used.
+Coloring colorSmallestLast(const CSRGraph &ig);
+
+void colorSmallestLast(const CSRGraph &ig, ColoringScratch &scratch,
+                       Coloring &colors);
+
+// maximumCardinalityOrder
+//
+// Maximum cardinality search (Tarjan and Yannakakis): repeatedly visits the
+// unvisited vertex with the most visited neighbors and returns the vertices
+// in the order they were visited. Uses the same kind of bucket queue as
+// smallestLastOrder, so it is O(V + E). On a chordal graph the reverse of
+// this order is a perfect elimination ordering.
+std::vector<CSRGraph::VertexId> maximumCardinalityOrder(const CSRGraph &ig);
+
+// Same as above, leaving the order in `scratch.order`.
+void maximumCardinalityOrder(const CSRGraph &ig, ColoringScratch &scratch);
+
+// colorChordal
+//
+// Optimal coloring of chordal graphs, which is what interference graphs of
+// programs in SSA form are. Checks in O(V + E) that the reverse of
+// maximumCardinalityOrder is a perfect elimination ordering and, if it is,
+// colors greedily in visit order into `colors`: every vertex then sees a
+// clique of colored neighbors, so exactly as many registers are used as the
+// largest clique has vertices. Returns false, with `colors` unspecified, if
+// the graph is not chordal.
+bool colorChordal(const CSRGraph &ig, Coloring &colors);
+
+bool colorChordal(const CSRGraph &ig, ColoringScratch &scratch,
+                  Coloring &colors);
+
+// colorDsatur
+//
+// Brélaz's DSATUR: repeatedly colors the uncolored vertex whose neighbors
+// already use the most distinct registers (its saturation), breaking ties
+// by degree among uncolored vertices, with the lowest free register. The
+// registers around each vertex are kept as a bitset and the vertices in an
+// indexed heap, so the whole pass is O((V + E) log V). Usually needs fewer
+// registers than smallest-last, is optimal on bipartite graphs, and never
+// uses more than maxDegree() + 1.
+Coloring colorDsatur(const CSRGraph &ig);
+
+void colorDsatur(const CSRGraph &ig, ColoringScratch &scratch,
+                 Coloring &colors);
+
+// colorBriggs
+//
+// Chaitin-Briggs simplify/select with optimistic coloring. Vertices of
+// degree < num_registers are simplified off a worklist that is refilled as
+// neighbor degrees drop; when it runs dry, the candidate with the lowest
+// spill cost per remaining edge is removed optimistically. Select then
+// colors in reverse order, and a vertex left with no free register is
+// spilled: it keeps register 0. Every other vertex gets a register in
+// [1, num_registers].
+//
+// `spill_costs[v]` is the cost of spilling vertex v; empty means all 1.
+Coloring colorBriggs(const CSRGraph &ig, int num_registers,
+                     const std::vector<double> &spill_costs = {});
+
+// colorJonesPlassmann
+//
+// Parallel greedy coloring. Every vertex gets a pseudo-random priority from
+// `seed`, and a vertex is colored, with the lowest register its colored
+// neighbors leave free, once all of its higher-priority neighbors are.
+// Each round colors an independent set of vertices on the thread pool.
+// The result is the sequential greedy coloring in priority order, so it
+// depends only on `seed` and not on the number of threads, and it never
+// uses more than maxDegree() + 1 registers. Total work is O(V + E). If
+// `stats` is given it receives the number of rounds; there are never
+// conflicts.
+Coloring colorJonesPlassmann(const CSRGraph &ig, ThreadPool &pool,
+                             std::uint64_t seed,
+                             ParallelStats *stats = nullptr);
+
+// Same as above on a pool of `num_threads` threads (0 for one per hardware
+// thread).
+Coloring colorJonesPlassmann(const CSRGraph &ig, unsigned num_threads,
+                             std::uint64_t seed,
+                             ParallelStats *stats = nullptr);
+
+// The priority colorJonesPlassmann gives vertex `v` for `seed`.
+std::uint64_t vertexPriority(std::uint64_t seed, CSRGraph::VertexId v) noexcept;
+
+// colorSpeculative
+//
+// Gebremedhin-Manne speculative parallel greedy coloring. The threads color
+// disjoint slices of the vertices at the same time without synchronizing,
+// each vertex getting the lowest register its neighbors seem to leave free.
+// A parallel pass then finds neighbors that raced to the same register and
+// only the one with the larger ID is colored again in the next round, until
+// no conflicts remain. On sparse graphs conflicts are rare and this takes
+// far fewer rounds than colorJonesPlassmann, but the result depends on
+// scheduling. Never uses more than maxDegree() + 1 registers, and one
+// thread gives plain greedy in ID order in a single round. If `stats` is
+// given it receives the rounds and the total number of recolored vertices.
+Coloring colorSpeculative(const CSRGraph &ig, ThreadPool &pool,
+                          ParallelStats *stats = nullptr);
+
+// Same as above on a pool of `num_threads` threads (0 for one per hardware
+// thread).
+Coloring colorSpeculative(const CSRGraph &ig, unsigned num_threads,
+                          ParallelStats *stats = nullptr);
+
+// greedyClique
+//
+// A large clique found greedily: starting from each vertex in decreasing
+// degree order, neighbors are added highest degree first whenever they
+// interfere with everything added so far. Its size is a lower bound on the
+// registers any coloring needs. Stops as soon as no remaining vertex has
+// the degree to beat the best clique, or once a clique of `stop_size`
+// vertices has been found.
+std::vector<CSRGraph::VertexId> greedyClique(const CSRGraph &ig,
+                                             unsigned stop_size = ~0u);
+
+// Outcome of colorExact.
+struct ExactColoring {
+  // The best coloring found; proper and complete even if not optimal.
+  Coloring colors;
+  // Size of the clique the search started from.
+  unsigned lower_bound;
+  // Whether no coloring with fewer registers exists.
+  bool optimal;
+  // Search nodes visited.
+  unsigned long nodes;
+};
+
+// colorExact
+//
+// DSATUR branch and bound for the minimum number of registers. colorDsatur
+// gives the first upper bound and greedyClique the lower bound; the clique
+// is colored 1..|clique| up front to break symmetry. The search then
+// colors the most saturated vertex with each register that is free next to
+// it and below the best count so far, keeping the registers around every
+// vertex as a bitset with per-register neighbor counts so that a step and
+// its undo are O(degree). It stops as soon as the bounds meet. When the
+// budget runs out first, the best coloring found is returned with `optimal`
+// false.
+ExactColoring colorExact(const CSRGraph &ig, const SearchBudget &budget = {});
+
+// Same as above, warm-started from a proper coloring `initial` and a clique
+// found earlier instead of computing both again.
+ExactColoring colorExact(const CSRGraph &ig, Coloring initial,
+                         const std::vector<CSRGraph::VertexId> &clique,
+                         const SearchBudget &budget = {});
+
+// rejectRegisters
+//
+// Checks whether `num_registers` is certainly too few for `ig` using lower
+// bounds that are much cheaper than coloring it, cheapest first:
+//
+//   - CompleteGraph: every pair of vertices interferes, O(1).
+//   - EdgeCount: more edges than Turán's theorem allows for a graph
+//     colorable with num_registers, O(1).
+//   - Clique: greedyClique, stopped as soon as it finds num_registers + 1
+//     vertices. Skipped when maxDegree() < num_registers, since then no
+//     clique is large enough (and any greedy coloring succeeds).
+//
+// Returns the first bound that exceeds num_registers with the number of
+// registers it proves necessary, or Bound::None if none does.
+Rejection rejectRegisters(const CSRGraph &ig, int num_registers);
+
+// improveTabu
+//
+// Local search that tries to take registers away from a proper coloring.
+// For k = numRegisters(colors) - 1 down to the size of greedyClique, the
+// vertices above register k are moved to their least conflicting register
+// and TabuCol repairs the conflicts: each step moves a conflicting vertex
+// to the register that removes the most conflicting edges, and moving it
+// back is forbidden for a while. A vertex-by-register matrix of neighbor
+// counts makes every candidate move O(1) to evaluate. Returns the coloring
+// for the last k that was reached, which is `colors` itself if none was.
+//
+// `budget` bounds the moves and the time of the whole pass; with neither
+// set it can run forever on a k that cannot be reached.
+Coloring improveTabu(const CSRGraph &ig, Coloring colors,
+                     const SearchBudget &budget, std::uint64_t seed = 0x5eed);
+
+// Same as above, stopping at a known lower bound `floor` instead of
+// computing a clique.
+Coloring improveTabu(const CSRGraph &ig, Coloring colors,
+                     const SearchBudget &budget, std::uint64_t seed,
+                     Register floor);
+
+// Outcome of minimizeColoring.
+struct MinimumColoring {
+  // The coloring with the fewest registers found.
+  Coloring colors;
+  // Size of the greedy clique; no coloring uses fewer registers.
+  unsigned lower_bound;
+  // The degeneracy plus one; smallest-last never uses more registers.
+  unsigned upper_bound;
+  // Whether no coloring with fewer registers exists.
+  bool optimal;
+};
+
+// minimizeColoring
+//
+// Searches for the fewest registers the graph can be colored with. The
+// bounds are computed once: greedyClique below, smallest-last order (and
+// with it the degeneracy) above. The better of the smallest-last and DSATUR
+// colorings, both run on the same scratch buffers, is the starting point.
+// From there the search descends one register at a time: improveTabu,
+// warm-started from the previous coloring, gets half of the time budget,
+// and colorExact, warm-started from tabu's result and the same clique, gets
+// the rest to close the gap or prove there is none. The node limit applies
+// to each stage separately, and a node-only budget bounds tabu search by
+// its moves alone. With no budget at all, neither a time nor a node limit,
+// tabu search is skipped and the exact search runs to completion. A chordal
+// graph never gets this far: colorChordal settles it, with both bounds
+// equal to its clique size.
+MinimumColoring minimizeColoring(const CSRGraph &ig,
+                                 const SearchBudget &budget,
+                                 std::uint64_t seed = 0x5eed);
+
+}; // namespace proj6
+
+#endif
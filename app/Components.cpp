@@ -0,0 +1,134 @@
+#include "Components.hpp"
+#include "Allocator.hpp"
+#include "DisjointSets.hpp"
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+using namespace proj6;
+
+using VertexId = CSRGraph::VertexId;
+
+Components proj6::connectedComponents(const CSRGraph &ig) {
+  const unsigned n = ig.numVertices();
+  DisjointSets sets(n);
+  for (VertexId v = 0; v < n; v++) {
+    ig.forEachNeighbor(v, [&](VertexId w) {
+      if (v < w) {
+        sets.unite(v, w);
+      }
+    });
+  }
+
+  // Number the components by their representatives and count their sizes.
+  std::vector<unsigned> component(n);
+  std::vector<unsigned> index(n, ~0u);
+  std::vector<unsigned> sizes;
+  for (VertexId v = 0; v < n; v++) {
+    const unsigned root = sets.find(v);
+    if (index[root] == ~0u) {
+      index[root] = (unsigned)sizes.size();
+      sizes.push_back(0);
+    }
+    component[v] = index[root];
+    sizes[component[v]]++;
+  }
+
+  // Largest first, so the biggest tasks start before the small ones.
+  std::vector<unsigned> order(sizes.size());
+  for (unsigned c = 0; c < order.size(); c++) {
+    order[c] = c;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](unsigned a, unsigned b) {
+    return sizes[a] > sizes[b];
+  });
+
+  Components components = {std::vector<VertexId>(n),
+                           std::vector<unsigned>(sizes.size() + 1, 0)};
+  std::vector<unsigned> start(sizes.size());
+  for (unsigned i = 0; i < order.size(); i++) {
+    start[order[i]] = components.offsets[i];
+    components.offsets[i + 1] = components.offsets[i] + sizes[order[i]];
+  }
+  for (VertexId v = 0; v < n; v++) {
+    components.vertices[start[component[v]]++] = v;
+  }
+
+  return components;
+}
+
+CSRGraph proj6::inducedSubgraph(const CSRGraph &ig,
+                                const VertexId *vertices, unsigned size,
+                                std::vector<VertexId> &local_id) {
+  for (unsigned i = 0; i < size; i++) {
+    local_id[vertices[i]] = i;
+  }
+  std::vector<unsigned> offsets = {0};
+  std::vector<VertexId> adjacency;
+  offsets.reserve(size + 1);
+  for (unsigned i = 0; i < size; i++) {
+    ig.forEachNeighbor(vertices[i], [&](VertexId w) {
+      if (local_id[w] < size && vertices[local_id[w]] == w) {
+        adjacency.push_back(local_id[w]);
+      }
+    });
+    offsets.push_back((unsigned)adjacency.size());
+  }
+
+  // Local IDs follow the global order, so neighbor lists stay sorted.
+  return CSRGraph(std::move(offsets), std::move(adjacency));
+}
+
+Coloring proj6::colorComponents(const CSRGraph &ig,
+                                const Components &components,
+                                Strategy strategy, ThreadPool &pool,
+                                Register limit) {
+  Coloring colors(ig.numVertices(), 0);
+  // Each vertex belongs to exactly one component, so threads write
+  // disjoint entries of `colors` and `local_id`.
+  std::vector<VertexId> local_id(ig.numVertices());
+  std::atomic<unsigned> next_component(0);
+  std::atomic<bool> over_limit(false);
+
+  pool.parallelFor(pool.size(), [&](unsigned) {
+    Allocator allocator(strategy, {1});
+
+    while (!over_limit.load(std::memory_order_relaxed)) {
+      const unsigned c = next_component++;
+      if (c >= components.count()) {
+        return;
+      }
+      const VertexId *const vertices =
+          components.vertices.data() + components.offsets[c];
+      const unsigned size = components.size(c);
+
+      unsigned long degree_sum = 0;
+      for (unsigned i = 0; i < size; i++) {
+        degree_sum += ig.degree(vertices[i]);
+      }
+      if (degree_sum == (unsigned long)size * (size - 1)) {
+        // A single vertex or a clique: every vertex needs its own register.
+        for (unsigned i = 0; i < size; i++) {
+          colors[vertices[i]] = (Register)i + 1;
+        }
+        if ((Register)size > limit) {
+          over_limit = true;
+        }
+        continue;
+      }
+
+      const CSRGraph component =
+          inducedSubgraph(ig, vertices, size, local_id);
+      const Coloring &local = allocator.color(component);
+      for (unsigned i = 0; i < size; i++) {
+        colors[vertices[i]] = local[i];
+      }
+      if (numRegisters(local) > limit) {
+        over_limit = true;
+      }
+    }
+  });
+
+  return colors;
+}
@@ -0,0 +1,66 @@
+#ifndef __COMPONENTS__HPP
+#define __COMPONENTS__HPP
+
+#include "CSRGraph.hpp"
+#include "Coloring.hpp"
+#include "ThreadPool.hpp"
+#include "proj6.hpp"
+#include <limits>
+#include <vector>
+
+namespace proj6 {
+
+// The connected components of a graph. Vertices are grouped by component,
+// largest component first, and each group is in ascending ID order.
+struct Components {
+  std::vector<CSRGraph::VertexId> vertices = {};
+  // Component c is vertices[offsets[c], offsets[c + 1]).
+  std::vector<unsigned> offsets = {0};
+
+  unsigned count() const noexcept { return (unsigned)offsets.size() - 1; }
+
+  unsigned size(unsigned c) const noexcept {
+    return offsets[c + 1] - offsets[c];
+  }
+};
+
+// connectedComponents
+//
+// Finds the components with a DisjointSets pass over the edges, then
+// groups the vertices with a counting sort. O(V + E).
+Components connectedComponents(const CSRGraph &ig);
+
+// inducedSubgraph
+//
+// Copies the subgraph induced by `vertices[0, size)`, which must be in
+// ascending order, into a compact sparse CSRGraph whose vertex i is
+// vertices[i]. `local_id` must have an entry for every vertex of `ig` and
+// ends up mapping each copied vertex to its new ID. Only the entries of
+// copied vertices and their neighbors are touched, so threads may share
+// one array while copying different components.
+CSRGraph inducedSubgraph(const CSRGraph &ig,
+                         const CSRGraph::VertexId *vertices, unsigned size,
+                         std::vector<CSRGraph::VertexId> &local_id);
+
+// colorComponents
+//
+// Colors every component on its own, spread over `pool`, and merges the
+// results; a component's registers never interact with another's, so the
+// merged coloring is proper and uses as many registers as its most
+// demanding component. Each thread keeps an Allocator with `strategy` and
+// copies each component it takes into a compact CSRGraph first, so the
+// engine runs over memory that belongs to that component alone.
+//
+// Components of one vertex get register 1 and complete components get
+// registers 1..size without building anything. Components are colored
+// serially, whatever the strategy; the parallelism is across components.
+//
+// Once a component needs more than `limit` registers the remaining ones
+// may be skipped and left at register 0.
+Coloring colorComponents(const CSRGraph &ig, const Components &components,
+                         Strategy strategy, ThreadPool &pool,
+                         Register limit = std::numeric_limits<Register>::max());
+
+}; // namespace proj6
+
+#endif
@@ -0,0 +1,35 @@
+#include "DisjointSets.hpp"
+#include <utility>
+
+DisjointSets::DisjointSets(unsigned size)
+    : parent(size), sizes(size, 1), num_sets(size) {
+  for (unsigned i = 0; i < size; i++) {
+    parent[i] = i;
+  }
+}
+
+unsigned DisjointSets::find(unsigned element) noexcept {
+  while (parent[element] != element) {
+    parent[element] = parent[parent[element]];
+    element = parent[element];
+  }
+  return element;
+}
+
+bool DisjointSets::unite(unsigned a, unsigned b) noexcept {
+  a = find(a);
+  b = find(b);
+  if (a == b) {
+    return false;
+  }
+
+  if (sizes[a] < sizes[b]) {
+    std::swap(a, b);
+  }
+  parent[b] = a;
+  sizes[a] += sizes[b];
+  num_sets--;
+  return true;
+}
+
+unsigned DisjointSets::count() const noexcept { return num_sets; }
@@ -0,0 +1,29 @@
+#ifndef __DISJOINT_SETS__HPP
+#define __DISJOINT_SETS__HPP
+
+#include <vector>
+
+// DisjointSets
+//
+// Union-find over the elements [0, n) with union by size and path halving,
+// so any sequence of operations runs in near-linear time.
+class DisjointSets {
+public:
+  explicit DisjointSets(unsigned size);
+
+  // The representative of the set containing `element`.
+  unsigned find(unsigned element) noexcept;
+
+  // Merges the sets of `a` and `b`. Returns false if they already were one.
+  bool unite(unsigned a, unsigned b) noexcept;
+
+  // Number of sets.
+  unsigned count() const noexcept;
+
+private:
+  std::vector<unsigned> parent;
+  std::vector<unsigned> sizes;
+  unsigned num_sets;
+};
+
+#endif
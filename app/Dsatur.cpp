@@ -0,0 +1,216 @@
+#include "Coloring.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace proj6;
+
+using VertexId = CSRGraph::VertexId;
+
+namespace {
+
+// The registers seen among each vertex's neighbors, one bitset per vertex.
+// Rows start one word wide and all grow together once a register beyond
+// the current width is used, so memory tracks the number of registers
+// actually in use rather than the maximum degree. The words live in a
+// caller-owned buffer so their memory can be reused.
+class SaturationSets {
+public:
+  SaturationSets(unsigned num_vertices, std::vector<std::uint64_t> &bits)
+      : num_vertices(num_vertices), row_words(1), bits(bits) {
+    bits.assign(num_vertices, 0);
+  }
+
+  // Records that `reg` is used next to v. Returns false if it already was.
+  bool add(VertexId v, Register reg) {
+    const unsigned word = (unsigned)reg / 64;
+    if (word >= row_words) {
+      grow(word + 1);
+    }
+
+    std::uint64_t &bits_word = bits[(std::size_t)v * row_words + word];
+    const std::uint64_t mask = std::uint64_t(1) << (reg % 64);
+    if ((bits_word & mask) != 0) {
+      return false;
+    }
+    bits_word |= mask;
+    return true;
+  }
+
+  // Lowest register >= 1 not used next to v.
+  Register lowestFree(VertexId v) const {
+    const std::uint64_t *row = &bits[(std::size_t)v * row_words];
+    for (unsigned word = 0; word < row_words; word++) {
+      // Register 0 is never used, so treat bit 0 of the first word as taken.
+      const std::uint64_t taken = word == 0 ? row[word] | 1 : row[word];
+      if (~taken != 0) {
+        return (Register)(word * 64 + (unsigned)__builtin_ctzll(~taken));
+      }
+    }
+    return (Register)(row_words * 64);
+  }
+
+private:
+  unsigned num_vertices;
+  unsigned row_words;
+  std::vector<std::uint64_t> &bits;
+
+  // Widens the rows in place, last row first so that no row is overwritten
+  // before it has been moved. Row 0 stays where it is.
+  void grow(unsigned words) {
+    words = std::max(words, 2 * row_words);
+    bits.resize((std::size_t)num_vertices * words);
+    for (std::size_t v = num_vertices; v-- > 0;) {
+      std::uint64_t *const old_row = &bits[v * row_words];
+      std::uint64_t *const new_row = &bits[v * words];
+      if (v > 0) {
+        std::copy_backward(old_row, old_row + row_words, new_row + row_words);
+      }
+      std::fill(new_row + row_words, new_row + words, 0);
+    }
+    row_words = words;
+  }
+};
+
+// A binary max-heap of the uncolored vertices that also knows where each
+// vertex sits, so a vertex's priority can be raised or lowered in place.
+// Priority is saturation, then degree among uncolored vertices, then the
+// lower vertex ID. The heap and the positions live in caller-owned buffers.
+class DsaturQueue {
+public:
+  DsaturQueue(const std::vector<unsigned> &saturation,
+              const std::vector<unsigned> &uncolored_degree,
+              std::vector<VertexId> &heap, std::vector<unsigned> &position)
+      : saturation(saturation), uncolored_degree(uncolored_degree),
+        heap(heap), position(position) {
+    heap.resize(saturation.size());
+    position.resize(saturation.size());
+    for (VertexId v = 0; v < heap.size(); v++) {
+      heap[v] = v;
+      position[v] = v;
+    }
+    for (unsigned i = (unsigned)heap.size() / 2; i-- > 0;) {
+      siftDown(i);
+    }
+  }
+
+  bool empty() const noexcept { return heap.empty(); }
+
+  VertexId pop() {
+    const VertexId top = heap.front();
+    position[top] = NOT_QUEUED;
+    heap.front() = heap.back();
+    heap.pop_back();
+    if (!heap.empty()) {
+      position[heap.front()] = 0;
+      siftDown(0);
+    }
+    return top;
+  }
+
+  bool contains(VertexId v) const noexcept {
+    return position[v] != NOT_QUEUED;
+  }
+
+  // Call after v's saturation or uncolored degree changed.
+  void update(VertexId v) {
+    siftUp(position[v]);
+    siftDown(position[v]);
+  }
+
+private:
+  static constexpr unsigned NOT_QUEUED = ~0u;
+
+  const std::vector<unsigned> &saturation;
+  const std::vector<unsigned> &uncolored_degree;
+  std::vector<VertexId> &heap;
+  std::vector<unsigned> &position;
+
+  bool before(VertexId v, VertexId w) const noexcept {
+    if (saturation[v] != saturation[w]) {
+      return saturation[v] > saturation[w];
+    }
+    if (uncolored_degree[v] != uncolored_degree[w]) {
+      return uncolored_degree[v] > uncolored_degree[w];
+    }
+    return v < w;
+  }
+
+  void place(unsigned i, VertexId v) {
+    heap[i] = v;
+    position[v] = i;
+  }
+
+  void siftUp(unsigned i) {
+    const VertexId v = heap[i];
+    while (i > 0 && before(v, heap[(i - 1) / 2])) {
+      place(i, heap[(i - 1) / 2]);
+      i = (i - 1) / 2;
+    }
+    place(i, v);
+  }
+
+  void siftDown(unsigned i) {
+    const VertexId v = heap[i];
+    while (true) {
+      unsigned child = 2 * i + 1;
+      if (child >= heap.size()) {
+        break;
+      }
+      if (child + 1 < heap.size() && before(heap[child + 1], heap[child])) {
+        child++;
+      }
+      if (!before(heap[child], v)) {
+        break;
+      }
+      place(i, heap[child]);
+      i = child;
+    }
+    place(i, v);
+  }
+};
+
+}; // namespace
+
+Coloring proj6::colorDsatur(const CSRGraph &ig) {
+  ColoringScratch scratch;
+  Coloring colors;
+  colorDsatur(ig, scratch, colors);
+  return colors;
+}
+
+void proj6::colorDsatur(const CSRGraph &ig, ColoringScratch &scratch,
+                        Coloring &colors) {
+  const unsigned n = ig.numVertices();
+  colors.assign(n, 0);
+  std::vector<unsigned> &saturation = scratch.saturation;
+  std::vector<unsigned> &uncolored_degree = scratch.degrees;
+  saturation.assign(n, 0);
+  uncolored_degree.resize(n);
+  for (VertexId v = 0; v < n; v++) {
+    uncolored_degree[v] = ig.degree(v);
+  }
+
+  SaturationSets seen(n, scratch.bits);
+  DsaturQueue queue(saturation, uncolored_degree, scratch.order,
+                    scratch.positions);
+
+  while (!queue.empty()) {
+    const VertexId v = queue.pop();
+    const Register reg = seen.lowestFree(v);
+    colors[v] = reg;
+
+    ig.forEachNeighbor(v, [&](VertexId u) {
+      if (!queue.contains(u)) {
+        return;
+      }
+      uncolored_degree[u]--;
+      if (seen.add(u, reg)) {
+        saturation[u]++;
+      }
+      queue.update(u);
+    });
+  }
+}
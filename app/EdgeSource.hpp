@@ -0,0 +1,39 @@
+#ifndef __EDGE_SOURCE__HPP
+#define __EDGE_SOURCE__HPP
+
+#include <string_view>
+
+// EdgeSink
+//
+// Receives the contents of a graph one event at a time. The views passed to
+// the callbacks are only valid for the duration of the call.
+//
+// Sources may report a vertex or an edge more than once (a CSV file reports
+// every cell and every edge row as written), so sinks that need sets must
+// deduplicate themselves. An edge is always preceded by vertex events for
+// both of its endpoints.
+class EdgeSink {
+public:
+  virtual ~EdgeSink() = default;
+
+  virtual void vertex(std::string_view name) = 0;
+
+  virtual void edge(std::string_view v, std::string_view w) = 0;
+};
+
+// EdgeSource
+//
+// A graph that can be replayed into an EdgeSink without first being built
+// in memory. Single-pass consumers (loaders, validation, statistics,
+// format conversion) take a source so they work on any graph file and keep
+// only what they need.
+class EdgeSource {
+public:
+  virtual ~EdgeSource() = default;
+
+  // Sends every vertex and edge of the graph to `sink`, in order. Throws
+  // std::runtime_error if the underlying data is malformed.
+  virtual void stream(EdgeSink &sink) = 0;
+};
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef __FROZEN_GRAPH__HPP
+#define __FROZEN_GRAPH__HPP
+
+#include "CSRGraph.hpp"
+#include "GraphExceptions.hpp"
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// FrozenGraph
+//
+// An immutable snapshot of an InterferenceGraph, produced by
+// InterferenceGraph::freeze(). The topology is a CSRGraph over dense vertex
+// IDs, and the snapshot keeps the ID-to-name table so results can be mapped
+// back to the original vertices.
+template <typename T> class FrozenGraph : public CSRGraph {
+public:
+  FrozenGraph();
+
+  // `names[id]` is the vertex with ID `id`. See CSRGraph for the layout of
+  // `offsets` and `adjacency`.
+  FrozenGraph(std::vector<T> names, std::vector<unsigned> offsets,
+              std::vector<VertexId> adjacency);
+
+  // Dense layout; see CSRGraph.
+  FrozenGraph(std::vector<T> names, BitMatrix matrix);
+
+  const T &name(VertexId v) const noexcept;
+
+  const std::vector<T> &names() const noexcept;
+
+  VertexId id(const T &vertex) const;
+
+private:
+  std::vector<T> id_to_name;
+  std::unordered_map<T, VertexId> name_to_id;
+};
+
+template <typename T>
+FrozenGraph<T>::FrozenGraph() : CSRGraph(), id_to_name({}), name_to_id({}) {}
+
+template <typename T>
+FrozenGraph<T>::FrozenGraph(std::vector<T> names,
+                            std::vector<unsigned> offsets,
+                            std::vector<VertexId> adjacency)
+    : CSRGraph(std::move(offsets), std::move(adjacency)),
+      id_to_name(std::move(names)), name_to_id({}) {
+  name_to_id.reserve(id_to_name.size());
+  for (VertexId v = 0; v < id_to_name.size(); v++) {
+    name_to_id.emplace(id_to_name[v], v);
+  }
+}
+
+template <typename T>
+FrozenGraph<T>::FrozenGraph(std::vector<T> names, BitMatrix matrix)
+    : CSRGraph(std::move(matrix)), id_to_name(std::move(names)),
+      name_to_id({}) {
+  name_to_id.reserve(id_to_name.size());
+  for (VertexId v = 0; v < id_to_name.size(); v++) {
+    name_to_id.emplace(id_to_name[v], v);
+  }
+}
+
+template <typename T>
+const T &FrozenGraph<T>::name(VertexId v) const noexcept {
+  return id_to_name[v];
+}
+
+template <typename T>
+const std::vector<T> &FrozenGraph<T>::names() const noexcept {
+  return id_to_name;
+}
+
+template <typename T>
+CSRGraph::VertexId FrozenGraph<T>::id(const T &vertex) const {
+  auto entry = name_to_id.find(vertex);
+
+  if (entry == name_to_id.end()) {
+    throw UnknownVertexException(vertex);
+  }
+
+  return entry->second;
+}
+
+#endif
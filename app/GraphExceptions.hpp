@@ -0,0 +1,25 @@
+#ifndef __GRAPH_EXCEPTIONS__HPP
+#define __GRAPH_EXCEPTIONS__HPP
+
+#include <stdexcept>
+#include <string>
+
+class UnknownVertexException : public std::runtime_error {
+public:
+  UnknownVertexException(const std::string &v)
+      : std::runtime_error("Unknown vertex " + v) {}
+
+  UnknownVertexException(unsigned v)
+      : UnknownVertexException(std::to_string(v)) {}
+};
+
+class UnknownEdgeException : public std::runtime_error {
+public:
+  UnknownEdgeException(const std::string &v, const std::string &w)
+      : std::runtime_error("Unknown edge " + v + " - " + w) {}
+
+  UnknownEdgeException(unsigned v, unsigned w)
+      : UnknownEdgeException(std::to_string(v), std::to_string(w)) {}
+};
+
+#endif
@@ -0,0 +1,51 @@
+#include "GraphStatistics.hpp"
+#include <algorithm>
+
+GraphStatistics::GraphStatistics()
+    : variables(), degrees({}), edge_rows(0) {}
+
+void GraphStatistics::vertex(std::string_view name) {
+  if (variables.intern(name) == degrees.size()) {
+    degrees.push_back(0);
+  }
+}
+
+void GraphStatistics::edge(std::string_view v, std::string_view w) {
+  degrees[variables.find(v)]++;
+  degrees[variables.find(w)]++;
+  edge_rows++;
+}
+
+unsigned GraphStatistics::numVertices() const noexcept {
+  return variables.size();
+}
+
+unsigned long GraphStatistics::numEdgeRows() const noexcept {
+  return edge_rows;
+}
+
+unsigned GraphStatistics::maxDegree() const noexcept {
+  return degrees.empty() ? 0
+                         : *std::max_element(degrees.begin(), degrees.end());
+}
+
+std::vector<unsigned> GraphStatistics::degreeHistogram() const {
+  std::vector<unsigned> histogram(degrees.empty() ? 0 : maxDegree() + 1, 0);
+  for (auto degree : degrees) {
+    histogram[degree]++;
+  }
+  return histogram;
+}
+
+void GraphStatistics::print(std::ostream &stream) const {
+  stream << "vertices: " << numVertices() << std::endl;
+  stream << "edge rows: " << numEdgeRows() << std::endl;
+  stream << "max degree: " << maxDegree() << std::endl;
+
+  const auto histogram = degreeHistogram();
+  for (unsigned degree = 0; degree < histogram.size(); degree++) {
+    if (histogram[degree] != 0) {
+      stream << "degree " << degree << ": " << histogram[degree] << std::endl;
+    }
+  }
+}
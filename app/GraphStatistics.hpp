@@ -0,0 +1,45 @@
+#ifndef __GRAPH_STATISTICS__HPP
+#define __GRAPH_STATISTICS__HPP
+
+#include "EdgeSource.hpp"
+#include "SymbolTable.hpp"
+#include "proj6.hpp"
+#include <ostream>
+#include <vector>
+
+using namespace proj6;
+
+// GraphStatistics
+//
+// An EdgeSink that summarizes a graph in a single pass: vertex and edge row
+// counts and the degree distribution. It keeps one counter per vertex and
+// never stores edges, so it can summarize graphs too large to load.
+//
+// Degrees count edge rows as the source reports them, so a CSV file that
+// lists an edge in both directions counts it twice, as the verifier does.
+class GraphStatistics : public EdgeSink {
+public:
+  GraphStatistics();
+
+  void vertex(std::string_view name) override;
+
+  void edge(std::string_view v, std::string_view w) override;
+
+  unsigned numVertices() const noexcept;
+
+  unsigned long numEdgeRows() const noexcept;
+
+  unsigned maxDegree() const noexcept;
+
+  // histogram[d] is the number of vertices of degree d.
+  std::vector<unsigned> degreeHistogram() const;
+
+  void print(std::ostream &stream) const;
+
+private:
+  SymbolTable variables;
+  std::vector<unsigned> degrees;
+  unsigned long edge_rows;
+};
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef __IG_BINARY_FORMAT__HPP
+#define __IG_BINARY_FORMAT__HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// Layout of the binary interference graph file written by IGBinaryWriter
+// and read by IGBinaryReader. All integers are in host byte order and every
+// section starts on an 8-byte boundary so it can be used in place once the
+// file is mapped:
+//
+//   IGBinaryHeader
+//   uint32_t offsets[num_vertices + 1]     CSR row offsets
+//   uint32_t adjacency[2 * num_edges]      sorted neighbor IDs
+//   uint64_t name_offsets[num_vertices + 1]
+//   char     names[name_bytes]             vertex names, not terminated
+//
+// Vertex v is named names[name_offsets[v], name_offsets[v + 1]).
+namespace igbinary {
+
+const char MAGIC[4] = {'I', 'G', 'B', 'F'};
+const std::uint32_t VERSION = 1;
+
+struct IGBinaryHeader {
+  char magic[4];
+  std::uint32_t version;
+  std::uint32_t num_vertices;
+  std::uint32_t num_edges;
+  std::uint64_t name_bytes;
+};
+
+inline std::size_t align8(std::size_t bytes) {
+  return (bytes + 7) & ~std::size_t(7);
+}
+
+inline std::size_t offsetsStart() { return align8(sizeof(IGBinaryHeader)); }
+
+inline std::size_t adjacencyStart(const IGBinaryHeader &header) {
+  return offsetsStart() +
+         align8(((std::size_t)header.num_vertices + 1) * sizeof(std::uint32_t));
+}
+
+inline std::size_t nameOffsetsStart(const IGBinaryHeader &header) {
+  return adjacencyStart(header) +
+         align8(2 * (std::size_t)header.num_edges * sizeof(std::uint32_t));
+}
+
+inline std::size_t namesStart(const IGBinaryHeader &header) {
+  return nameOffsetsStart(header) +
+         ((std::size_t)header.num_vertices + 1) * sizeof(std::uint64_t);
+}
+
+// Saturates instead of wrapping around on a corrupt `name_bytes`.
+inline std::size_t fileSize(const IGBinaryHeader &header) {
+  const std::size_t start = namesStart(header);
+  return header.name_bytes > SIZE_MAX - start
+             ? SIZE_MAX
+             : start + (std::size_t)header.name_bytes;
+}
+
+}; // namespace igbinary
+
+#endif
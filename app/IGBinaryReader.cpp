@@ -0,0 +1,137 @@
+/**
+   IGBinaryReader.cpp
+
+   See IGBinaryReader.hpp and IGBinaryFormat.hpp.
+
+*/
+
+#include "IGBinaryReader.hpp"
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace igbinary;
+
+IGBinaryReader::IGBinaryReader(const std::string &path)
+    : file(path), header(), offsets(nullptr), adjacency(nullptr),
+      name_offsets(nullptr), names(nullptr) {
+  if (!file.isOpen()) {
+    throw std::runtime_error("File " + path + " does not exist!");
+  }
+
+  if (file.size() < sizeof(header) ||
+      std::memcmp(file.data(), MAGIC, sizeof(MAGIC)) != 0) {
+    throw std::runtime_error("File " + path + " is not a binary graph!");
+  }
+
+  std::memcpy(&header, file.data(), sizeof(header));
+  if (header.version != VERSION) {
+    throw std::runtime_error("File " + path +
+                             " has unsupported binary graph version " +
+                             std::to_string(header.version));
+  }
+
+  if (file.size() < fileSize(header)) {
+    throw std::runtime_error("File " + path + " is truncated!");
+  }
+
+  // The mapping is page-aligned, a read buffer at least 8-byte aligned, and
+  // every section is 8-byte aligned.
+  offsets =
+      reinterpret_cast<const std::uint32_t *>(file.data() + offsetsStart());
+  adjacency = reinterpret_cast<const std::uint32_t *>(file.data() +
+                                                      adjacencyStart(header));
+  name_offsets = reinterpret_cast<const std::uint64_t *>(
+      file.data() + nameOffsetsStart(header));
+  names = file.data() + namesStart(header);
+
+  // Everything the accessors and freeze() index with comes from the file,
+  // so check it all once: offsets that start at 0, never decrease and end
+  // at the edge and name counts, and neighbor lists that are strictly
+  // increasing (CSRGraph::interferes binary-searches them), in range and
+  // free of self-loops. It is one pass over arrays freeze() copies anyway.
+  const unsigned n = header.num_vertices;
+  bool consistent = offsets[0] == 0 &&
+                    offsets[n] == 2 * (std::uint64_t)header.num_edges &&
+                    name_offsets[0] == 0 &&
+                    name_offsets[n] <= header.name_bytes;
+  for (CSRGraph::VertexId v = 0; v < n && consistent; v++) {
+    consistent = offsets[v] <= offsets[v + 1] &&
+                 name_offsets[v] <= name_offsets[v + 1];
+    for (std::uint32_t i = offsets[v]; i < offsets[v + 1] && consistent;
+         i++) {
+      consistent = adjacency[i] < n && adjacency[i] != v &&
+                   (i == offsets[v] || adjacency[i - 1] < adjacency[i]);
+    }
+  }
+  if (!consistent) {
+    throw std::runtime_error("File " + path + " is not a binary graph!");
+  }
+}
+
+bool IGBinaryReader::isBinary(const std::string &path) noexcept {
+  // Peeking into a pipe would consume what the CSV loader needs to read.
+  if (!MappedFile::isRegular(path)) {
+    return false;
+  }
+  try {
+    MappedFile file(path);
+    return file.size() >= sizeof(MAGIC) &&
+           std::memcmp(file.data(), MAGIC, sizeof(MAGIC)) == 0;
+  } catch (const std::runtime_error &) {
+    return false;
+  }
+}
+
+unsigned IGBinaryReader::numVertices() const noexcept {
+  return header.num_vertices;
+}
+
+unsigned IGBinaryReader::numEdges() const noexcept { return header.num_edges; }
+
+unsigned IGBinaryReader::degree(CSRGraph::VertexId v) const noexcept {
+  return offsets[v + 1] - offsets[v];
+}
+
+const std::uint32_t *
+IGBinaryReader::neighborsBegin(CSRGraph::VertexId v) const noexcept {
+  return adjacency + offsets[v];
+}
+
+const std::uint32_t *
+IGBinaryReader::neighborsEnd(CSRGraph::VertexId v) const noexcept {
+  return adjacency + offsets[v + 1];
+}
+
+std::string_view IGBinaryReader::name(CSRGraph::VertexId v) const noexcept {
+  return std::string_view(names + name_offsets[v],
+                          name_offsets[v + 1] - name_offsets[v]);
+}
+
+FrozenGraph<Symbol> IGBinaryReader::freeze(SymbolTable &symbols) const {
+  std::vector<Symbol> vertex_symbols;
+  vertex_symbols.reserve(numVertices());
+  for (CSRGraph::VertexId v = 0; v < numVertices(); v++) {
+    vertex_symbols.push_back(symbols.intern(name(v)));
+  }
+
+  return FrozenGraph<Symbol>(
+      std::move(vertex_symbols),
+      std::vector<unsigned>(offsets, offsets + numVertices() + 1),
+      std::vector<CSRGraph::VertexId>(adjacency, adjacency + 2 * numEdges()));
+}
+
+void IGBinaryReader::stream(EdgeSink &sink) {
+  for (CSRGraph::VertexId v = 0; v < numVertices(); v++) {
+    sink.vertex(name(v));
+  }
+
+  for (CSRGraph::VertexId v = 0; v < numVertices(); v++) {
+    for (auto w = neighborsBegin(v); w != neighborsEnd(v); w++) {
+      if (v < *w) {
+        sink.edge(name(v), name(*w));
+      }
+    }
+  }
+}
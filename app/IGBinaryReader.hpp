@@ -0,0 +1,66 @@
+/**
+   IGBinaryReader.hpp
+
+   Reads interference graphs written by IGBinaryWriter. The file is mapped
+   into memory and its arrays are used in place, so opening a graph costs
+   no parsing at all; see IGBinaryFormat.hpp for the layout.
+
+*/
+
+#ifndef IG_BINARY_READER_H
+#define IG_BINARY_READER_H
+
+#include "CSRGraph.hpp"
+#include "EdgeSource.hpp"
+#include "FrozenGraph.hpp"
+#include "IGBinaryFormat.hpp"
+#include "MappedFile.hpp"
+#include "SymbolTable.hpp"
+#include "proj6.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+using namespace proj6;
+
+class IGBinaryReader : public EdgeSource {
+public:
+  // Maps the binary graph at `path`. Throws std::runtime_error if the file
+  // does not exist or is not a complete, consistent graph file of a
+  // supported version. Every offset and neighbor ID is checked, so the
+  // accessors below stay within the file whatever it contains.
+  explicit IGBinaryReader(const std::string &path);
+
+  // True if `path` names a file that starts like a binary graph file.
+  static bool isBinary(const std::string &path) noexcept;
+
+  unsigned numVertices() const noexcept;
+
+  unsigned numEdges() const noexcept;
+
+  unsigned degree(CSRGraph::VertexId v) const noexcept;
+
+  // The sorted neighbors of `v`, straight from the mapped file.
+  const std::uint32_t *neighborsBegin(CSRGraph::VertexId v) const noexcept;
+
+  const std::uint32_t *neighborsEnd(CSRGraph::VertexId v) const noexcept;
+
+  std::string_view name(CSRGraph::VertexId v) const noexcept;
+
+  // Copies the mapped arrays into a FrozenGraph, interning every vertex name
+  // in `symbols`.
+  FrozenGraph<Symbol> freeze(SymbolTable &symbols) const;
+
+  // Reports every vertex once, then every edge once.
+  void stream(EdgeSink &sink) override;
+
+private:
+  MappedFile file;
+  igbinary::IGBinaryHeader header;
+  const std::uint32_t *offsets;
+  const std::uint32_t *adjacency;
+  const std::uint64_t *name_offsets;
+  const char *names;
+};
+
+#endif
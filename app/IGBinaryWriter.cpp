@@ -0,0 +1,106 @@
+/**
+   IGBinaryWriter.cpp
+
+   See IGBinaryWriter.hpp and IGBinaryFormat.hpp.
+
+*/
+
+#include "IGBinaryWriter.hpp"
+#include "CSVReader.hpp"
+#include "IGBinaryFormat.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace igbinary;
+
+namespace {
+
+void pad(std::ofstream &stream) {
+  static const char zeros[8] = {};
+  const auto position = (std::size_t)stream.tellp();
+  stream.write(zeros, (std::streamsize)(align8(position) - position));
+}
+
+template <typename T>
+void writeArray(std::ofstream &stream, const std::vector<T> &values) {
+  stream.write(reinterpret_cast<const char *>(values.data()),
+               (std::streamsize)(values.size() * sizeof(T)));
+  pad(stream);
+}
+
+// `name_of(v)` returns the name of vertex v as something with data() and
+// size().
+template <typename NameOf>
+void writeGraph(const CSRGraph &ig, NameOf name_of, const std::string &path) {
+  std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+
+  if (!stream.good()) {
+    throw std::runtime_error("File " + path + " could not be written!");
+  }
+
+  std::vector<std::uint32_t> offsets = {0};
+  std::vector<std::uint32_t> adjacency;
+  std::vector<std::uint64_t> name_offsets = {0};
+  offsets.reserve(ig.numVertices() + 1);
+  adjacency.reserve(2 * (std::size_t)ig.numEdges());
+  name_offsets.reserve(ig.numVertices() + 1);
+
+  for (CSRGraph::VertexId v = 0; v < ig.numVertices(); v++) {
+    ig.forEachNeighbor(v,
+                       [&](CSRGraph::VertexId w) { adjacency.push_back(w); });
+    offsets.push_back((std::uint32_t)adjacency.size());
+    name_offsets.push_back(name_offsets.back() + name_of(v).size());
+  }
+
+  IGBinaryHeader header;
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.num_vertices = ig.numVertices();
+  header.num_edges = ig.numEdges();
+  header.name_bytes = name_offsets.back();
+
+  stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  pad(stream);
+  writeArray(stream, offsets);
+  writeArray(stream, adjacency);
+  writeArray(stream, name_offsets);
+  for (CSRGraph::VertexId v = 0; v < ig.numVertices(); v++) {
+    const auto &name = name_of(v);
+    stream.write(name.data(), (std::streamsize)name.size());
+  }
+
+  if (!stream.good()) {
+    throw std::runtime_error("File " + path + " could not be written!");
+  }
+}
+
+}; // namespace
+
+void IGBinaryWriter::write(const FrozenGraph<Variable> &ig,
+                           const std::string &path) {
+  writeGraph(
+      ig, [&](CSRGraph::VertexId v) -> const Variable & { return ig.name(v); },
+      path);
+}
+
+void IGBinaryWriter::write(const FrozenGraph<Symbol> &ig,
+                           const SymbolTable &symbols,
+                           const std::string &path) {
+  writeGraph(
+      ig,
+      [&](CSRGraph::VertexId v) -> const Variable & {
+        return symbols.name(ig.name(v));
+      },
+      path);
+}
+
+void IGBinaryWriter::convert(const std::string &csv_path,
+                             const std::string &binary_path) {
+  SymbolTable symbols;
+  const auto &ig = CSVReader::load(csv_path, symbols)
+                       .freeze(CSRGraph::Layout::Sparse);
+  write(ig, symbols, binary_path);
+}
@@ -0,0 +1,34 @@
+/**
+   IGBinaryWriter.hpp
+
+   Writes interference graphs in the binary format described in
+   IGBinaryFormat.hpp. A graph written once can be mapped by IGBinaryReader
+   on every later run instead of parsing the CSV file again.
+
+*/
+
+#ifndef IG_BINARY_WRITER_H
+#define IG_BINARY_WRITER_H
+
+#include "FrozenGraph.hpp"
+#include "SymbolTable.hpp"
+#include "proj6.hpp"
+#include <string>
+
+using namespace proj6;
+
+class IGBinaryWriter {
+public:
+  static void write(const FrozenGraph<Variable> &ig, const std::string &path);
+
+  static void write(const FrozenGraph<Symbol> &ig, const SymbolTable &symbols,
+                    const std::string &path);
+
+  // Converts the CSV graph file at `csv_path` (see CSVReader) into a binary
+  // graph file at `binary_path`. Duplicate and reversed edge rows are
+  // collapsed on the way.
+  static void convert(const std::string &csv_path,
+                      const std::string &binary_path);
+};
+
+#endif
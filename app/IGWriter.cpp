@@ -12,7 +12,6 @@
 
 #include <array>
 #include <fstream>
-#include <set>
 #include <utility>
 
 namespace {
@@ -24,12 +23,13 @@ std::string lookupColor(const Variable &var,
   std::array<std::string, NUM_DEFAULT_COLORS> const colors = {
       "lightpink",       "lightsalmon",  "lightseagreen",   "lightskyblue4",
       "lightsteelblue1", "lightyellow1", "lightgoldenrod4", "lightcoral"};
-  if (regAssignment.find(var) == regAssignment.end()) {
+  auto const entry = regAssignment.find(var);
+  if (entry == regAssignment.end()) {
     // Value didn't get colored
     return "white";
   }
 
-  int const reg = regAssignment.at(var);
+  int const reg = entry->second;
 
   // Lookup color for this register
   if (reg <= NUM_DEFAULT_COLORS && reg >= 1) {
@@ -41,29 +41,34 @@ std::string lookupColor(const Variable &var,
 }
 
 void writeEdges(const InterferenceGraph<Variable> &ig, std::ofstream &stream) {
-
-  std::set<InterferenceGraph<Variable>::EdgeTy> written_edges;
-
-  for (const auto &source : ig.vertices()) {
-    for (const auto &destination : ig.neighbors(source)) {
-
-      if (written_edges.find(InterferenceGraph<Variable>::EdgeTy(
-              source, destination)) != written_edges.end() ||
-          written_edges.find(InterferenceGraph<Variable>::EdgeTy(
-              destination, source)) != written_edges.end()) {
-        continue;
+  // Every edge appears in both endpoints' neighbor sets; only write it from
+  // the endpoint that sorts first.
+  for (const auto &source : ig.verticesView()) {
+    ig.forEachNeighbor(source, [&](const Variable &destination) {
+      if (source < destination) {
+        stream << source << " -- " << destination << std::endl;
       }
+    });
+  }
+}
 
-      stream << source << " -- " << destination << std::endl;
-      written_edges.insert(
-          InterferenceGraph<Variable>::EdgeTy(source, destination));
-    }
+void writeEdges(const FrozenGraph<Variable> &ig, std::ofstream &stream) {
+  // Every edge appears in both endpoints' neighbor lists; only write it from
+  // the endpoint with the smaller ID.
+  for (CSRGraph::VertexId source = 0; source < ig.numVertices(); source++) {
+    ig.forEachNeighbor(source, [&](CSRGraph::VertexId destination) {
+      if (source < destination) {
+        stream << ig.name(source) << " -- " << ig.name(destination)
+               << std::endl;
+      }
+    });
   }
 }
 
-void writeNodes(const InterferenceGraph<Variable> &ig, std::ofstream &stream,
+template <typename Vertices>
+void writeNodes(const Vertices &vertices, std::ofstream &stream,
                 const RegisterAssignment &register_assignment) {
-  for (const auto &vertex : ig.vertices()) {
+  for (const auto &vertex : vertices) {
     stream << vertex;
     stream << " [style=\"filled\", fillcolor="
            << lookupColor(vertex, register_assignment) << "]" << std::endl;
@@ -72,15 +77,19 @@ void writeNodes(const InterferenceGraph<Variable> &ig, std::ofstream &stream,
 
 void writeIG(const InterferenceGraph<Variable> &ig, std::ofstream &stream,
              const RegisterAssignment &register_assignment) {
-  writeNodes(ig, stream, register_assignment);
+  writeNodes(ig.verticesView(), stream, register_assignment);
   writeEdges(ig, stream);
 }
 
-}; // namespace
+void writeIG(const FrozenGraph<Variable> &ig, std::ofstream &stream,
+             const RegisterAssignment &register_assignment) {
+  writeNodes(ig.names(), stream, register_assignment);
+  writeEdges(ig, stream);
+}
 
-void IGWriter::write(const InterferenceGraph<Variable> &ig,
-                     const std::string &path,
-                     const RegisterAssignment &register_assignment) {
+template <typename Graph>
+void writeGraph(const Graph &ig, const std::string &path,
+                const RegisterAssignment &register_assignment) {
   std::ofstream fs;
   fs.open(path);
   fs << "graph {" << std::endl;
@@ -88,4 +97,17 @@ void IGWriter::write(const InterferenceGraph<Variable> &ig,
   writeIG(ig, fs, register_assignment);
   fs << "}";
   fs.close();
+}
+
+}; // namespace
+
+void IGWriter::write(const InterferenceGraph<Variable> &ig,
+                     const std::string &path,
+                     const RegisterAssignment &register_assignment) {
+  writeGraph(ig, path, register_assignment);
+}
+
+void IGWriter::write(const FrozenGraph<Variable> &ig, const std::string &path,
+                     const RegisterAssignment &register_assignment) {
+  writeGraph(ig, path, register_assignment);
 }
\ No newline at end of file
@@ -41,6 +41,7 @@
 #ifndef IG_WRITER_H
 #define IG_WRITER_H
 
+#include "FrozenGraph.hpp"
 #include "InterferenceGraph.hpp"
 #include "proj6.hpp"
 #include <string>
@@ -52,6 +53,9 @@ public:
   static void write(const InterferenceGraph<Variable> &IG,
                     const std::string &path,
                     const RegisterAssignment &registerAssignment);
+
+  static void write(const FrozenGraph<Variable> &IG, const std::string &path,
+                    const RegisterAssignment &registerAssignment);
 };
 
 #endif
\ No newline at end of file
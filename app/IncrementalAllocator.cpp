@@ -0,0 +1,166 @@
+#include "IncrementalAllocator.hpp"
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+using namespace proj6;
+
+namespace {
+
+// Most vertices a Kempe swap may recolor. Longer chains cost more than a
+// repair is worth, and reallocating starts to look cheap.
+const unsigned KEMPE_CHAIN_LIMIT = 256;
+
+}; // namespace
+
+IncrementalAllocator::IncrementalAllocator(InterferenceGraph<Variable> &ig,
+                                           int num_registers,
+                                           Strategy strategy)
+    : ig(ig), num_registers(num_registers), strategy(strategy), current(),
+      feasible(false), edited(false), dirty(), repair_stats() {
+  reallocate();
+  repair_stats.reallocations = 0;
+  ig.subscribe(this);
+}
+
+IncrementalAllocator::~IncrementalAllocator() { ig.unsubscribe(this); }
+
+const RegisterAssignment &IncrementalAllocator::update() {
+  if (!edited) {
+    return current;
+  }
+  edited = false;
+  if (!feasible) {
+    // Edits may have made the graph colorable, but there is nothing to
+    // repair; start over.
+    reallocate();
+    return current;
+  }
+
+  std::unordered_set<Variable> pending;
+  pending.swap(dirty);
+  for (const Variable &vertex : pending) {
+    current.erase(vertex);
+  }
+  for (const Variable &vertex : pending) {
+    Register reg = lowestFree(vertex);
+    if (reg == 0) {
+      reg = kempeSwap(vertex);
+    }
+    if (reg == 0) {
+      reallocate();
+      return current;
+    }
+    current[vertex] = reg;
+    repair_stats.recolored++;
+  }
+  return current;
+}
+
+const RegisterAssignment &IncrementalAllocator::assignment() const noexcept {
+  return current;
+}
+
+const RepairStats &IncrementalAllocator::stats() const noexcept {
+  return repair_stats;
+}
+
+void IncrementalAllocator::vertexAdded(const Variable &vertex) {
+  edited = true;
+  dirty.insert(vertex);
+}
+
+void IncrementalAllocator::vertexRemoved(const Variable &vertex) {
+  edited = true;
+  dirty.erase(vertex);
+  current.erase(vertex);
+}
+
+void IncrementalAllocator::edgeAdded(const Variable &v, const Variable &w) {
+  edited = true;
+  const auto v_reg = current.find(v);
+  const auto w_reg = current.find(w);
+  if (v_reg != current.end() && w_reg != current.end() &&
+      v_reg->second == w_reg->second) {
+    dirty.insert(ig.degree(v) < ig.degree(w) ? v : w);
+  }
+}
+
+void IncrementalAllocator::edgeRemoved(const Variable &, const Variable &) {
+  edited = true;
+}
+
+void IncrementalAllocator::reallocate() {
+  repair_stats.reallocations++;
+  current = assignRegisters(ig, num_registers, strategy);
+  feasible = !current.empty() || ig.numVertices() == 0;
+  dirty.clear();
+}
+
+Register IncrementalAllocator::lowestFree(const Variable &vertex) const {
+  std::vector<bool> taken(std::max(num_registers, 0) + 1, false);
+  ig.forEachNeighbor(vertex, [&](const Variable &neighbor) {
+    const auto reg = current.find(neighbor);
+    if (reg != current.end()) {
+      taken[reg->second] = true;
+    }
+  });
+  for (Register reg = 1; reg <= num_registers; reg++) {
+    if (!taken[reg]) {
+      return reg;
+    }
+  }
+  return 0;
+}
+
+Register IncrementalAllocator::kempeSwap(const Variable &vertex) {
+  for (Register a = 1; a <= num_registers; a++) {
+    for (Register b = 1; b <= num_registers; b++) {
+      if (a == b) {
+        continue;
+      }
+
+      // The (a, b) chains through the neighbors holding a. Swapping them
+      // frees a next to `vertex` as long as none of them also reaches a
+      // neighbor holding b, which would then hold a.
+      std::vector<const Variable *> chain;
+      std::unordered_set<Variable> seen;
+      bool blocked = false;
+      ig.forEachNeighbor(vertex, [&](const Variable &neighbor) {
+        const auto reg = current.find(neighbor);
+        if (reg != current.end() && reg->second == a &&
+            seen.insert(neighbor).second) {
+          chain.push_back(&reg->first);
+        }
+      });
+
+      for (unsigned i = 0; i < chain.size() && !blocked; i++) {
+        const Variable &member = *chain[i];
+        if (current.at(member) == b && ig.interferes(member, vertex)) {
+          blocked = true;
+          continue;
+        }
+        const Register other = current.at(member) == a ? b : a;
+        ig.forEachNeighbor(member, [&](const Variable &neighbor) {
+          const auto reg = current.find(neighbor);
+          if (reg != current.end() && reg->second == other &&
+              seen.insert(neighbor).second) {
+            chain.push_back(&reg->first);
+          }
+        });
+        blocked = chain.size() > KEMPE_CHAIN_LIMIT;
+      }
+      if (blocked) {
+        continue;
+      }
+
+      for (const Variable *member : chain) {
+        Register &reg = current.at(*member);
+        reg = reg == a ? b : a;
+      }
+      repair_stats.kempe_swaps++;
+      return a;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,94 @@
+#ifndef __INCREMENTAL_ALLOCATOR__HPP
+#define __INCREMENTAL_ALLOCATOR__HPP
+
+#include "InterferenceGraph.hpp"
+#include "proj6.hpp"
+#include <unordered_set>
+
+namespace proj6 {
+
+// What IncrementalAllocator::update has done so far.
+struct RepairStats {
+  // Vertices given a register one at a time.
+  unsigned long recolored = 0;
+  // Kempe chains swapped to free a register.
+  unsigned long kempe_swaps = 0;
+  // Times the whole graph was allocated again.
+  unsigned long reallocations = 0;
+};
+
+// IncrementalAllocator
+//
+// Keeps a register assignment for an InterferenceGraph that keeps
+// changing. It subscribes to the graph and only notes which variables
+// were affected by each edit: a new variable, or one endpoint of a new
+// edge whose endpoints share a register. Removing edges or variables
+// never breaks an assignment, so those only drop what is gone.
+//
+// update() then repairs the noted variables alone. Each one gets the
+// lowest register its neighbors leave free. If none is free, an (a, b)
+// Kempe chain swap is tried: the chains through its neighbors holding a
+// are swapped to b, unless one of them reaches a neighbor holding b or
+// grows past a small limit. Only when that fails as well is the whole
+// graph allocated again with assignRegisters. The cost of an update thus
+// follows the size of the edit, not the size of the graph.
+//
+// The graph must outlive the allocator.
+class IncrementalAllocator : public InterferenceGraph<Variable>::Observer {
+public:
+  // Allocates `ig` with assignRegisters and subscribes to it.
+  IncrementalAllocator(InterferenceGraph<Variable> &ig, int num_registers,
+                       Strategy strategy = Strategy::Dsatur);
+
+  IncrementalAllocator(const IncrementalAllocator &) = delete;
+
+  IncrementalAllocator &operator=(const IncrementalAllocator &) = delete;
+
+  ~IncrementalAllocator() override;
+
+  // Repairs the assignment after the edits made since the last call and
+  // returns it. Same contract as assignRegisters: empty if `num_registers`
+  // is not enough for the graph.
+  const RegisterAssignment &update();
+
+  // The assignment as of the last update().
+  const RegisterAssignment &assignment() const noexcept;
+
+  const RepairStats &stats() const noexcept;
+
+  void vertexAdded(const Variable &vertex) override;
+
+  void vertexRemoved(const Variable &vertex) override;
+
+  void edgeAdded(const Variable &v, const Variable &w) override;
+
+  void edgeRemoved(const Variable &v, const Variable &w) override;
+
+private:
+  InterferenceGraph<Variable> &ig;
+  const int num_registers;
+  const Strategy strategy;
+  RegisterAssignment current;
+  // Whether `current` is a valid assignment; false after a failed
+  // allocation.
+  bool feasible;
+  // Whether the graph changed since the last update().
+  bool edited;
+  // Variables that lost their register and need a new one.
+  std::unordered_set<Variable> dirty;
+  RepairStats repair_stats;
+
+  void reallocate();
+
+  // Lowest register in [1, num_registers] no neighbor of `vertex` holds,
+  // or 0.
+  Register lowestFree(const Variable &vertex) const;
+
+  // Frees a register for `vertex` with a Kempe chain swap and returns it,
+  // or returns 0 and changes nothing.
+  Register kempeSwap(const Variable &vertex);
+};
+
+}; // namespace proj6
+
+#endif
@@ -1,23 +1,16 @@
 #ifndef __INTERFERENCE_GRAPH__HPP
 #define __INTERFERENCE_GRAPH__HPP
 
-#include <exception>
+#include "FrozenGraph.hpp"
+#include "GraphExceptions.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
-
-class UnknownVertexException : public std::runtime_error {
-public:
-  UnknownVertexException(const std::string &v)
-      : std::runtime_error("Unknown vertex " + v) {}
-};
-
-class UnknownEdgeException : public std::runtime_error {
-public:
-  UnknownEdgeException(const std::string &v, const std::string &w)
-      : std::runtime_error("Unknown edge " + v + " - " + w) {}
-};
+#include <vector>
 
 // InterferenceGraph
 //
@@ -33,10 +26,92 @@ public:
   // the graph structure to/from files. You don't need to use it.
   using EdgeTy = std::pair<T, T>;
 
+  // Read-only range over a vertex set owned by the graph. Iterating a view
+  // neither copies nor allocates; a view is invalidated by any change to the
+  // graph.
+  class SetView {
+  public:
+    using const_iterator = typename std::unordered_set<T>::const_iterator;
+
+    explicit SetView(const std::unordered_set<T> &set) noexcept
+        : items(&set) {}
+
+    const_iterator begin() const noexcept { return items->begin(); }
+
+    const_iterator end() const noexcept { return items->end(); }
+
+    unsigned size() const noexcept { return (unsigned)items->size(); }
+
+    bool empty() const noexcept { return items->empty(); }
+
+    bool contains(const T &vertex) const { return items->count(vertex) != 0; }
+
+  private:
+    const std::unordered_set<T> *items;
+  };
+
+  // Observer
+  //
+  // Told about every change made to a graph it is subscribed to, right
+  // after the change. removeVertex reports only the vertex, not the edges
+  // that went with it. Observers must not change the graph themselves.
+  class Observer {
+  public:
+    virtual ~Observer() {}
+
+    virtual void vertexAdded(const T &) {}
+
+    virtual void vertexRemoved(const T &) {}
+
+    virtual void edgeAdded(const T &, const T &) {}
+
+    virtual void edgeRemoved(const T &, const T &) {}
+  };
+
   InterferenceGraph();
 
+  // Copies and moves take the vertices and edges only; observers stay
+  // subscribed to the graph they subscribed to, and open checkpoints stay
+  // behind too.
+  InterferenceGraph(const InterferenceGraph &other);
+
+  InterferenceGraph(InterferenceGraph &&other) noexcept;
+
+  InterferenceGraph &operator=(const InterferenceGraph &other);
+
+  InterferenceGraph &operator=(InterferenceGraph &&other) noexcept;
+
   ~InterferenceGraph();
 
+  // Starts or stops reporting changes to `observer`, which must stay alive
+  // until it is unsubscribed.
+  void subscribe(Observer *observer);
+
+  void unsubscribe(Observer *observer) noexcept;
+
+  // checkpoint
+  //
+  // Opens a checkpoint. Until it is closed by rollback() or commit(), every
+  // change is also written to a journal, and a removed vertex keeps its
+  // neighbor set there instead of having it freed. Checkpoints nest.
+  void checkpoint();
+
+  // rollback
+  //
+  // Undoes every change made since the innermost open checkpoint, newest
+  // first, and closes it. Takes time proportional to the number of changes
+  // undone and copies nothing. Observers are told about each undo as a
+  // change of its own. Throws std::runtime_error if no checkpoint is open.
+  void rollback();
+
+  // Keeps the changes made since the innermost open checkpoint and closes
+  // it. They can still be undone by rolling back an outer checkpoint.
+  // Throws std::runtime_error if no checkpoint is open.
+  void commit();
+
+  // Number of open checkpoints.
+  unsigned numCheckpoints() const noexcept;
+
   void addEdge(const T &v, const T &w);
 
   void addVertex(const T &vertex) noexcept;
@@ -49,6 +124,14 @@ public:
 
   std::unordered_set<T> neighbors(const T &vertex) const;
 
+  // Allocation-free alternatives to vertices() and neighbors().
+  SetView verticesView() const noexcept;
+
+  SetView neighborsView(const T &vertex) const;
+
+  // Calls `visit` with every neighbor of `vertex`.
+  template <typename F> void forEachNeighbor(const T &vertex, F &&visit) const;
+
   unsigned numVertices() const noexcept;
 
   unsigned numEdges() const noexcept;
@@ -57,19 +140,268 @@ public:
 
   unsigned degree(const T &v) const;
 
+  // indexDegrees
+  //
+  // Starts keeping the vertices in doubly linked buckets by degree, built
+  // in O(V + E), or with `enabled` false drops the index. While it is kept,
+  // every change keeps it up to date: O(1) per edge added or removed and
+  // O(degree) per vertex removed, plus a walk over empty buckets when the
+  // lowest or highest one runs empty. A copy of an indexed graph builds an
+  // index of its own.
+  void indexDegrees(bool enabled = true);
+
+  bool degreesIndexed() const noexcept;
+
+  // Largest and smallest degree, or 0 for an empty graph. O(1) with the
+  // degree index, a scan over every vertex without it.
+  unsigned maxDegree() const noexcept;
+
+  unsigned minDegree() const noexcept;
+
+  // Number of vertices with exactly `degree` neighbors.
+  unsigned numVerticesOfDegree(unsigned degree) const noexcept;
+
+  // Calls `visit` with every vertex that has exactly `degree` neighbors,
+  // which must not change the graph. With the degree index this costs only
+  // the vertices visited.
+  template <typename F>
+  void forEachVertexOfDegree(unsigned degree, F &&visit) const;
+
+  // Builds an immutable CSR snapshot of the current graph. Vertex IDs are
+  // assigned in vertices() iteration order. Layout::Auto stores the snapshot
+  // as a bit matrix when the graph is dense enough for that to be smaller.
+  FrozenGraph<T>
+  freeze(CSRGraph::Layout layout = CSRGraph::Layout::Auto) const;
+
 private:
   // Private member variables here.
   std::unordered_map<T, std::unordered_set<T>> graph;
   std::unordered_set<T> vertices_set;
   unsigned num_edges;
+  std::vector<Observer *> observers;
+
+  // A change made while a checkpoint was open.
+  struct Change {
+    enum class Kind { AddVertex, RemoveVertex, AddEdge, RemoveEdge };
+
+    Kind kind;
+    T v;
+    T w;
+    // The neighbors a removed vertex had.
+    std::unordered_set<T> neighbors;
+  };
+
+  std::vector<Change> journal;
+  // Where the changes of each open checkpoint start in the journal.
+  std::vector<std::size_t> checkpoints;
+
+  // A vertex's place in the bucket of its degree.
+  struct BucketEntry {
+    const T *vertex;
+    BucketEntry *prev;
+    BucketEntry *next;
+  };
+
+  bool indexed;
+  std::unordered_map<T, BucketEntry> bucket_entries;
+  // First entry and number of vertices of each degree.
+  std::vector<BucketEntry *> bucket_heads;
+  std::vector<unsigned> bucket_sizes;
+  unsigned max_degree;
+  unsigned min_degree;
+
+  void undo(Change &change);
+
+  void indexVertex(const T &vertex, unsigned degree);
+
+  void unindexVertex(const T &vertex, unsigned degree);
+
+  // Moves `vertex` from the bucket of `old_degree` to that of `degree`.
+  void degreeChanged(const T &vertex, unsigned old_degree, unsigned degree);
+
+  void bucketInsert(BucketEntry &entry, unsigned degree);
+
+  void bucketErase(BucketEntry &entry, unsigned degree) noexcept;
+
+  // Moves max_degree and min_degree past buckets that ran empty.
+  void shrinkDegreeBounds() noexcept;
 };
 
 template <typename T>
 InterferenceGraph<T>::InterferenceGraph()
-    : graph({}), vertices_set({}), num_edges(0) {}
+    : graph({}), vertices_set({}), num_edges(0), observers(), journal(),
+      checkpoints(), indexed(false), bucket_entries(), bucket_heads(),
+      bucket_sizes(), max_degree(0), min_degree(0) {}
+
+template <typename T>
+InterferenceGraph<T>::InterferenceGraph(const InterferenceGraph &other)
+    : graph(other.graph), vertices_set(other.vertices_set),
+      num_edges(other.num_edges), observers(), journal(), checkpoints(),
+      indexed(false), bucket_entries(), bucket_heads(), bucket_sizes(),
+      max_degree(0), min_degree(0) {
+  // The entries point into the other graph's index, so build new ones.
+  indexDegrees(other.indexed);
+}
+
+template <typename T>
+InterferenceGraph<T>::InterferenceGraph(InterferenceGraph &&other) noexcept
+    : graph(std::move(other.graph)),
+      vertices_set(std::move(other.vertices_set)),
+      num_edges(other.num_edges), observers(), journal(), checkpoints(),
+      indexed(other.indexed), bucket_entries(std::move(other.bucket_entries)),
+      bucket_heads(std::move(other.bucket_heads)),
+      bucket_sizes(std::move(other.bucket_sizes)),
+      max_degree(other.max_degree), min_degree(other.min_degree) {
+  other.indexed = false;
+}
+
+template <typename T>
+InterferenceGraph<T> &
+InterferenceGraph<T>::operator=(const InterferenceGraph &other) {
+  if (this == &other) {
+    return *this;
+  }
+  indexDegrees(false);
+  graph = other.graph;
+  vertices_set = other.vertices_set;
+  num_edges = other.num_edges;
+  journal.clear();
+  checkpoints.clear();
+  indexDegrees(other.indexed);
+  return *this;
+}
+
+template <typename T>
+InterferenceGraph<T> &
+InterferenceGraph<T>::operator=(InterferenceGraph &&other) noexcept {
+  graph = std::move(other.graph);
+  vertices_set = std::move(other.vertices_set);
+  num_edges = other.num_edges;
+  journal.clear();
+  checkpoints.clear();
+  indexed = other.indexed;
+  bucket_entries = std::move(other.bucket_entries);
+  bucket_heads = std::move(other.bucket_heads);
+  bucket_sizes = std::move(other.bucket_sizes);
+  max_degree = other.max_degree;
+  min_degree = other.min_degree;
+  other.indexed = false;
+  return *this;
+}
 
 template <typename T> InterferenceGraph<T>::~InterferenceGraph() {}
 
+template <typename T>
+void InterferenceGraph<T>::subscribe(Observer *observer) {
+  observers.push_back(observer);
+}
+
+template <typename T>
+void InterferenceGraph<T>::unsubscribe(Observer *observer) noexcept {
+  observers.erase(std::remove(observers.begin(), observers.end(), observer),
+                  observers.end());
+}
+
+template <typename T> void InterferenceGraph<T>::checkpoint() {
+  checkpoints.push_back(journal.size());
+}
+
+template <typename T> void InterferenceGraph<T>::rollback() {
+  if (checkpoints.empty()) {
+    throw std::runtime_error("No checkpoint to roll back to");
+  }
+  const std::size_t start = checkpoints.back();
+  checkpoints.pop_back();
+
+  while (journal.size() > start) {
+    undo(journal.back());
+    journal.pop_back();
+  }
+}
+
+template <typename T> void InterferenceGraph<T>::commit() {
+  if (checkpoints.empty()) {
+    throw std::runtime_error("No checkpoint to commit");
+  }
+  checkpoints.pop_back();
+  if (checkpoints.empty()) {
+    journal.clear();
+  }
+}
+
+template <typename T>
+unsigned InterferenceGraph<T>::numCheckpoints() const noexcept {
+  return (unsigned)checkpoints.size();
+}
+
+template <typename T> void InterferenceGraph<T>::undo(Change &change) {
+  switch (change.kind) {
+  case Change::Kind::AddVertex:
+    // Everything added to the vertex later has been undone already.
+    if (indexed) {
+      unindexVertex(change.v, 0);
+    }
+    graph.erase(change.v);
+    vertices_set.erase(change.v);
+    for (Observer *observer : observers) {
+      observer->vertexRemoved(change.v);
+    }
+    break;
+  case Change::Kind::RemoveVertex: {
+    auto &neighbors = graph[change.v];
+    neighbors = std::move(change.neighbors);
+    vertices_set.insert(change.v);
+    num_edges += (unsigned)neighbors.size();
+    if (indexed) {
+      indexVertex(change.v, (unsigned)neighbors.size());
+    }
+    for (const auto &neighbor : neighbors) {
+      auto &their_neighbors = graph.find(neighbor)->second;
+      their_neighbors.insert(change.v);
+      if (indexed) {
+        const auto degree = (unsigned)their_neighbors.size();
+        degreeChanged(neighbor, degree - 1, degree);
+      }
+    }
+    for (Observer *observer : observers) {
+      observer->vertexAdded(change.v);
+      for (const auto &neighbor : neighbors) {
+        observer->edgeAdded(change.v, neighbor);
+      }
+    }
+    break;
+  }
+  case Change::Kind::AddEdge:
+    for (const T *vertex : {&change.v, &change.w}) {
+      auto &neighbors = graph.find(*vertex)->second;
+      neighbors.erase(vertex == &change.v ? change.w : change.v);
+      if (indexed) {
+        const auto degree = (unsigned)neighbors.size();
+        degreeChanged(*vertex, degree + 1, degree);
+      }
+    }
+    num_edges--;
+    for (Observer *observer : observers) {
+      observer->edgeRemoved(change.v, change.w);
+    }
+    break;
+  case Change::Kind::RemoveEdge:
+    for (const T *vertex : {&change.v, &change.w}) {
+      auto &neighbors = graph.find(*vertex)->second;
+      neighbors.insert(vertex == &change.v ? change.w : change.v);
+      if (indexed) {
+        const auto degree = (unsigned)neighbors.size();
+        degreeChanged(*vertex, degree - 1, degree);
+      }
+    }
+    num_edges++;
+    for (Observer *observer : observers) {
+      observer->edgeAdded(change.v, change.w);
+    }
+    break;
+  }
+}
+
 template <typename T>
 std::unordered_set<T> InterferenceGraph<T>::neighbors(const T &vertex) const {
   auto vertex_node = graph.find(vertex);
@@ -86,6 +418,32 @@ std::unordered_set<T> InterferenceGraph<T>::vertices() const noexcept {
   return vertices_set;
 }
 
+template <typename T>
+typename InterferenceGraph<T>::SetView
+InterferenceGraph<T>::verticesView() const noexcept {
+  return SetView(vertices_set);
+}
+
+template <typename T>
+typename InterferenceGraph<T>::SetView
+InterferenceGraph<T>::neighborsView(const T &vertex) const {
+  auto vertex_node = graph.find(vertex);
+
+  if (vertex_node == graph.end()) {
+    throw UnknownVertexException(vertex);
+  }
+
+  return SetView(vertex_node->second);
+}
+
+template <typename T>
+template <typename F>
+void InterferenceGraph<T>::forEachNeighbor(const T &vertex, F &&visit) const {
+  for (const auto &neighbor : neighborsView(vertex)) {
+    visit(neighbor);
+  }
+}
+
 template <typename T>
 unsigned InterferenceGraph<T>::numVertices() const noexcept {
   return (unsigned)vertices_set.size();
@@ -111,6 +469,18 @@ void InterferenceGraph<T>::addEdge(const T &v, const T &w) {
     vertex_1->second.insert(w);
     vertex_2->second.insert(v);
     num_edges++;
+    if (indexed) {
+      const auto degree_1 = (unsigned)vertex_1->second.size();
+      const auto degree_2 = (unsigned)vertex_2->second.size();
+      degreeChanged(v, degree_1 - 1, degree_1);
+      degreeChanged(w, degree_2 - 1, degree_2);
+    }
+    if (!checkpoints.empty()) {
+      journal.push_back({Change::Kind::AddEdge, v, w, {}});
+    }
+    for (Observer *observer : observers) {
+      observer->edgeAdded(v, w);
+    }
   }
 }
 
@@ -133,6 +503,18 @@ void InterferenceGraph<T>::removeEdge(const T &v, const T &w) {
     vertex_1->second.erase(w);
     vertex_2->second.erase(v);
     num_edges--;
+    if (indexed) {
+      const auto degree_1 = (unsigned)vertex_1->second.size();
+      const auto degree_2 = (unsigned)vertex_2->second.size();
+      degreeChanged(v, degree_1 + 1, degree_1);
+      degreeChanged(w, degree_2 + 1, degree_2);
+    }
+    if (!checkpoints.empty()) {
+      journal.push_back({Change::Kind::RemoveEdge, v, w, {}});
+    }
+    for (Observer *observer : observers) {
+      observer->edgeRemoved(v, w);
+    }
   }
 }
 
@@ -141,6 +523,15 @@ void InterferenceGraph<T>::addVertex(const T &vertex) noexcept {
   if (graph.find(vertex) == graph.end()) {
     graph[vertex] = {};
     vertices_set.insert(vertex);
+    if (indexed) {
+      indexVertex(vertex, 0);
+    }
+    if (!checkpoints.empty()) {
+      journal.push_back({Change::Kind::AddVertex, vertex, {}, {}});
+    }
+    for (Observer *observer : observers) {
+      observer->vertexAdded(vertex);
+    }
   }
 }
 
@@ -150,13 +541,28 @@ template <typename T> void InterferenceGraph<T>::removeVertex(const T &vertex) {
   } else {
     auto vertex_node = graph.find(vertex);
 
-    for (auto v : vertex_node->second) {
+    for (const auto &v : vertex_node->second) {
       auto temp_vertex = graph.find(v);
       temp_vertex->second.erase(vertex);
+      if (indexed) {
+        const auto degree = (unsigned)temp_vertex->second.size();
+        degreeChanged(v, degree + 1, degree);
+      }
+    }
+    num_edges -= (unsigned)vertex_node->second.size();
+    if (indexed) {
+      unindexVertex(vertex, (unsigned)vertex_node->second.size());
     }
 
-    graph.erase(vertex);
+    if (!checkpoints.empty()) {
+      journal.push_back({Change::Kind::RemoveVertex, vertex, {},
+                         std::move(vertex_node->second)});
+    }
+    graph.erase(vertex_node);
     vertices_set.erase(vertex);
+    for (Observer *observer : observers) {
+      observer->vertexRemoved(vertex);
+    }
   }
 }
 
@@ -189,4 +595,200 @@ template <typename T> unsigned InterferenceGraph<T>::degree(const T &v) const {
   return (unsigned)vertex_1->second.size();
 }
 
+template <typename T> void InterferenceGraph<T>::indexDegrees(bool enabled) {
+  if (enabled == indexed) {
+    return;
+  }
+  indexed = enabled;
+  bucket_entries.clear();
+  bucket_heads.clear();
+  bucket_sizes.clear();
+  max_degree = 0;
+  min_degree = 0;
+  if (!enabled) {
+    return;
+  }
+
+  bucket_entries.reserve(graph.size());
+  min_degree = ~0u;
+  for (const auto &vertex : graph) {
+    indexVertex(vertex.first, (unsigned)vertex.second.size());
+  }
+  shrinkDegreeBounds();
+}
+
+template <typename T>
+bool InterferenceGraph<T>::degreesIndexed() const noexcept {
+  return indexed;
+}
+
+template <typename T>
+unsigned InterferenceGraph<T>::maxDegree() const noexcept {
+  if (indexed) {
+    return max_degree;
+  }
+  unsigned max = 0;
+  for (const auto &vertex : graph) {
+    max = std::max(max, (unsigned)vertex.second.size());
+  }
+  return max;
+}
+
+template <typename T>
+unsigned InterferenceGraph<T>::minDegree() const noexcept {
+  if (indexed) {
+    return min_degree;
+  }
+  unsigned min = graph.empty() ? 0 : ~0u;
+  for (const auto &vertex : graph) {
+    min = std::min(min, (unsigned)vertex.second.size());
+  }
+  return min;
+}
+
+template <typename T>
+unsigned
+InterferenceGraph<T>::numVerticesOfDegree(unsigned degree) const noexcept {
+  if (indexed) {
+    return degree < bucket_sizes.size() ? bucket_sizes[degree] : 0;
+  }
+  unsigned count = 0;
+  for (const auto &vertex : graph) {
+    count += vertex.second.size() == degree;
+  }
+  return count;
+}
+
+template <typename T>
+template <typename F>
+void InterferenceGraph<T>::forEachVertexOfDegree(unsigned degree,
+                                                 F &&visit) const {
+  if (!indexed) {
+    for (const auto &vertex : graph) {
+      if (vertex.second.size() == degree) {
+        visit(vertex.first);
+      }
+    }
+    return;
+  }
+  if (degree >= bucket_heads.size()) {
+    return;
+  }
+  for (const BucketEntry *entry = bucket_heads[degree]; entry != nullptr;
+       entry = entry->next) {
+    visit(*entry->vertex);
+  }
+}
+
+template <typename T>
+void InterferenceGraph<T>::indexVertex(const T &vertex, unsigned degree) {
+  auto entry = bucket_entries.emplace(vertex, BucketEntry()).first;
+  entry->second.vertex = &entry->first;
+  bucketInsert(entry->second, degree);
+}
+
+template <typename T>
+void InterferenceGraph<T>::unindexVertex(const T &vertex, unsigned degree) {
+  auto entry = bucket_entries.find(vertex);
+  bucketErase(entry->second, degree);
+  bucket_entries.erase(entry);
+  shrinkDegreeBounds();
+}
+
+template <typename T>
+void InterferenceGraph<T>::degreeChanged(const T &vertex, unsigned old_degree,
+                                         unsigned degree) {
+  BucketEntry &entry = bucket_entries.find(vertex)->second;
+  bucketErase(entry, old_degree);
+  bucketInsert(entry, degree);
+  shrinkDegreeBounds();
+}
+
+template <typename T>
+void InterferenceGraph<T>::bucketInsert(BucketEntry &entry, unsigned degree) {
+  if (degree >= bucket_heads.size()) {
+    bucket_heads.resize(degree + 1, nullptr);
+    bucket_sizes.resize(degree + 1, 0);
+  }
+  entry.prev = nullptr;
+  entry.next = bucket_heads[degree];
+  if (entry.next != nullptr) {
+    entry.next->prev = &entry;
+  }
+  bucket_heads[degree] = &entry;
+  bucket_sizes[degree]++;
+  max_degree = std::max(max_degree, degree);
+  min_degree = std::min(min_degree, degree);
+}
+
+template <typename T>
+void InterferenceGraph<T>::bucketErase(BucketEntry &entry,
+                                       unsigned degree) noexcept {
+  if (entry.prev != nullptr) {
+    entry.prev->next = entry.next;
+  } else {
+    bucket_heads[degree] = entry.next;
+  }
+  if (entry.next != nullptr) {
+    entry.next->prev = entry.prev;
+  }
+  bucket_sizes[degree]--;
+}
+
+template <typename T>
+void InterferenceGraph<T>::shrinkDegreeBounds() noexcept {
+  if (bucket_entries.empty()) {
+    max_degree = 0;
+    min_degree = 0;
+    return;
+  }
+  while (bucket_sizes[max_degree] == 0) {
+    max_degree--;
+  }
+  while (bucket_sizes[min_degree] == 0) {
+    min_degree++;
+  }
+}
+
+template <typename T>
+FrozenGraph<T> InterferenceGraph<T>::freeze(CSRGraph::Layout layout) const {
+  std::vector<T> names(vertices_set.begin(), vertices_set.end());
+  std::unordered_map<T, CSRGraph::VertexId> ids;
+  ids.reserve(names.size());
+  for (CSRGraph::VertexId v = 0; v < names.size(); v++) {
+    ids.emplace(names[v], v);
+  }
+
+  if (layout == CSRGraph::Layout::Auto) {
+    layout = CSRGraph::preferredLayout((unsigned)names.size(), num_edges);
+  }
+
+  if (layout == CSRGraph::Layout::Dense) {
+    BitMatrix matrix((unsigned)names.size());
+    for (CSRGraph::VertexId v = 0; v < names.size(); v++) {
+      forEachNeighbor(names[v], [&](const T &neighbor) {
+        matrix.set(v, ids.find(neighbor)->second);
+      });
+    }
+    return FrozenGraph<T>(std::move(names), std::move(matrix));
+  }
+
+  std::vector<unsigned> offsets = {0};
+  std::vector<CSRGraph::VertexId> adjacency;
+  offsets.reserve(names.size() + 1);
+  adjacency.reserve(2 * (std::size_t)num_edges);
+
+  for (const auto &vertex : names) {
+    const auto row_begin = adjacency.size();
+    forEachNeighbor(vertex, [&](const T &neighbor) {
+      adjacency.push_back(ids.find(neighbor)->second);
+    });
+    std::sort(adjacency.begin() + row_begin, adjacency.end());
+    offsets.push_back((unsigned)adjacency.size());
+  }
+
+  return FrozenGraph<T>(std::move(names), std::move(offsets),
+                        std::move(adjacency));
+}
+
 #endif
@@ -0,0 +1,119 @@
+#include "Coloring.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace proj6;
+
+using VertexId = CSRGraph::VertexId;
+
+std::uint64_t proj6::vertexPriority(std::uint64_t seed, VertexId v) noexcept {
+  // splitmix64 of the seeded vertex ID.
+  std::uint64_t z = seed + 0x9e3779b97f4a7c15ull * ((std::uint64_t)v + 1);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+Coloring proj6::colorJonesPlassmann(const CSRGraph &ig, ThreadPool &pool,
+                                    std::uint64_t seed, ParallelStats *stats) {
+  const unsigned n = ig.numVertices();
+  const unsigned max_degree = ig.maxDegree();
+
+  std::vector<std::uint64_t> priority(n);
+  for (VertexId v = 0; v < n; v++) {
+    priority[v] = vertexPriority(seed, v);
+  }
+  auto before = [&](VertexId v, VertexId w) {
+    return priority[v] != priority[w] ? priority[v] > priority[w] : v < w;
+  };
+
+  // Fixed task count, so each task index owns its scratch buffers across
+  // rounds; no two tasks with the same index ever run at once.
+  const unsigned num_tasks = 4 * pool.size();
+  auto range = [&](unsigned task, std::size_t size) {
+    return std::make_pair(size * task / num_tasks,
+                          size * (task + 1) / num_tasks);
+  };
+
+  // waiting[v] counts the neighbors of v that come before it and are not
+  // colored yet. v is colored in the round after it reaches zero.
+  std::unique_ptr<std::atomic<unsigned>[]> waiting(
+      new std::atomic<unsigned>[n]);
+  std::vector<std::vector<VertexId>> ready(num_tasks);
+
+  pool.parallelFor(num_tasks, [&](unsigned task) {
+    const auto vertices = range(task, n);
+    for (VertexId v = (VertexId)vertices.first; v < vertices.second; v++) {
+      unsigned count = 0;
+      ig.forEachNeighbor(v, [&](VertexId w) { count += before(w, v); });
+      waiting[v].store(count, std::memory_order_relaxed);
+      if (count == 0) {
+        ready[task].push_back(v);
+      }
+    }
+  });
+
+  Coloring colors(n, 0);
+  std::vector<std::vector<VertexId>> forbidden(
+      num_tasks, std::vector<VertexId>(max_degree + 2, n));
+  std::vector<std::vector<VertexId>> next(num_tasks);
+  std::vector<VertexId> round;
+  unsigned rounds = 0;
+
+  while (true) {
+    round.clear();
+    for (auto &vertices : ready) {
+      round.insert(round.end(), vertices.begin(), vertices.end());
+      vertices.clear();
+    }
+    if (round.empty()) {
+      break;
+    }
+    rounds++;
+
+    // Every vertex in a round has all of its earlier neighbors colored and
+    // no neighbor in the same round, so the colors each one reads are
+    // final and the result does not depend on the thread count.
+    pool.parallelFor(num_tasks, [&](unsigned task) {
+      std::vector<VertexId> &marks = forbidden[task];
+      const auto vertices = range(task, round.size());
+
+      for (std::size_t i = vertices.first; i < vertices.second; i++) {
+        const VertexId v = round[i];
+        ig.forEachNeighbor(v, [&](VertexId w) {
+          if (before(w, v)) {
+            marks[colors[w]] = v;
+          }
+        });
+
+        Register reg = 1;
+        while (marks[reg] == v) {
+          reg++;
+        }
+        colors[v] = reg;
+
+        ig.forEachNeighbor(v, [&](VertexId w) {
+          if (before(v, w) &&
+              waiting[w].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            next[task].push_back(w);
+          }
+        });
+      }
+    });
+
+    std::swap(ready, next);
+  }
+
+  if (stats != nullptr) {
+    *stats = {rounds, 0};
+  }
+  return colors;
+}
+
+Coloring proj6::colorJonesPlassmann(const CSRGraph &ig, unsigned num_threads,
+                                    std::uint64_t seed, ParallelStats *stats) {
+  ThreadPool pool(num_threads);
+  return colorJonesPlassmann(ig, pool, seed, stats);
+}
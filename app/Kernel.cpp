@@ -0,0 +1,66 @@
+#include "Kernel.hpp"
+#include "SubgraphView.hpp"
+#include <vector>
+
+using namespace proj6;
+
+using VertexId = CSRGraph::VertexId;
+
+Kernel proj6::peelLowDegree(const CSRGraph &ig, unsigned k) {
+  const unsigned n = ig.numVertices();
+  SubgraphView remaining(ig);
+  std::vector<VertexId> low;
+  for (VertexId v = 0; v < n; v++) {
+    if (remaining.degree(v) < k) {
+      low.push_back(v);
+    }
+  }
+
+  Kernel kernel;
+  kernel.peeled.reserve(n);
+  while (!low.empty()) {
+    const VertexId v = low.back();
+    low.pop_back();
+    remaining.deactivate(v);
+    kernel.peeled.push_back(v);
+
+    // Only the drop from k to k - 1 queues a neighbor, so it is queued
+    // once.
+    remaining.forEachNeighbor(v, [&](VertexId u) {
+      if (remaining.degree(u) == k - 1) {
+        low.push_back(u);
+      }
+    });
+  }
+
+  kernel.core.reserve(remaining.numActive());
+  for (VertexId v = 0; v < n; v++) {
+    if (remaining.isActive(v)) {
+      kernel.core.push_back(v);
+    }
+  }
+  return kernel;
+}
+
+void proj6::colorPeeled(const CSRGraph &ig,
+                        const std::vector<VertexId> &peeled,
+                        Coloring &colors) {
+  const VertexId NONE = ig.numVertices();
+  // forbidden[r] == v while coloring v means a neighbor of v holds r.
+  std::vector<VertexId> forbidden(ig.maxDegree() + 2, NONE);
+
+  for (auto it = peeled.rbegin(); it != peeled.rend(); ++it) {
+    const VertexId v = *it;
+    ig.forEachNeighbor(v, [&](VertexId w) {
+      if (colors[w] != 0) {
+        forbidden[colors[w]] = v;
+      }
+    });
+
+    Register reg = 1;
+    while (forbidden[reg] == v) {
+      reg++;
+    }
+    colors[v] = reg;
+  }
+}
@@ -0,0 +1,42 @@
+#ifndef __KERNEL__HPP
+#define __KERNEL__HPP
+
+#include "CSRGraph.hpp"
+#include "Coloring.hpp"
+#include <vector>
+
+namespace proj6 {
+
+// What is left of a graph after every vertex with fewer than k remaining
+// neighbors has been peeled away.
+struct Kernel {
+  // Peeled vertices in the order they were peeled.
+  std::vector<CSRGraph::VertexId> peeled;
+  // The k-core: every vertex that was never peeled, in ascending order.
+  std::vector<CSRGraph::VertexId> core;
+};
+
+// peelLowDegree
+//
+// Repeatedly removes a vertex with fewer than `k` neighbors left, the
+// simplify step of Chaitin's allocator without the spilling. The graph is
+// peeled through a SubgraphView, which keeps the remaining degrees, and
+// vertices drop onto a worklist once theirs falls below k, so the whole
+// pass is O(V + E) and `ig` is left as it was. The core does not depend on
+// the order vertices are peeled in.
+Kernel peelLowDegree(const CSRGraph &ig, unsigned k);
+
+// colorPeeled
+//
+// Colors `peeled` in reverse, given a proper coloring of everything else
+// in `colors`, each vertex with the lowest register its neighbors leave
+// free. A vertex had fewer than k neighbors left when it was peeled, and
+// exactly those are colored before it, so no register above
+// max(k, numRegisters(colors)) is ever needed.
+void colorPeeled(const CSRGraph &ig,
+                 const std::vector<CSRGraph::VertexId> &peeled,
+                 Coloring &colors);
+
+}; // namespace proj6
+
+#endif
@@ -0,0 +1,67 @@
+#include "Coloring.hpp"
+#include <cstdint>
+
+using namespace proj6;
+
+namespace {
+
+// turanEdges
+//
+// The most edges a graph on n vertices can have and still be colorable with
+// k registers (Turán's theorem): the complete k-partite graph with parts as
+// equal as possible.
+std::uint64_t turanEdges(std::uint64_t n, std::uint64_t k) {
+  if (k >= n) {
+    return n * (n - 1) / 2;
+  }
+  const std::uint64_t r = n % k;
+  return ((k - 1) * n * n - r * (k - r)) / (2 * k);
+}
+
+}; // namespace
+
+Rejection proj6::rejectRegisters(const CSRGraph &ig, int num_registers) {
+  const std::uint64_t n = ig.numVertices();
+  const std::uint64_t m = ig.numEdges();
+
+  if (n == 0) {
+    return {};
+  }
+  if (num_registers < 1) {
+    // Turán's bound for zero parts: not even an edgeless graph fits.
+    return {Bound::EdgeCount, 1};
+  }
+  const auto k = (std::uint64_t)num_registers;
+  if (k >= n) {
+    return {};
+  }
+
+  if (m == n * (n - 1) / 2) {
+    return {Bound::CompleteGraph, (int)n};
+  }
+
+  if (m > turanEdges(n, k)) {
+    // The fewest registers the edge count allows; turanEdges grows with k.
+    std::uint64_t low = k + 1, high = n;
+    while (low < high) {
+      const std::uint64_t mid = low + (high - low) / 2;
+      if (m > turanEdges(n, mid)) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return {Bound::EdgeCount, (int)low};
+  }
+
+  // A clique through v has at most degree(v) + 1 vertices.
+  if (ig.maxDegree() < k) {
+    return {};
+  }
+  const auto clique = greedyClique(ig, (unsigned)k + 1);
+  if (clique.size() > k) {
+    return {Bound::Clique, (int)clique.size()};
+  }
+
+  return {};
+}
@@ -0,0 +1,88 @@
+#include "MappedFile.hpp"
+#include <cerrno>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string &path)
+    : fd(-1), mapping(nullptr), length(0), buffer() {
+  fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+
+  struct stat info;
+  if (::fstat(fd, &info) != 0) {
+    ::close(fd);
+    throw std::runtime_error("File " + path + " could not be read!");
+  }
+  if (S_ISREG(info.st_mode) && info.st_size == 0) {
+    // Nothing to map.
+    return;
+  }
+
+  if (S_ISREG(info.st_mode)) {
+    void *address = ::mmap(nullptr, (std::size_t)info.st_size, PROT_READ,
+                           MAP_PRIVATE, fd, 0);
+    if (address != MAP_FAILED) {
+      mapping = address;
+      length = (std::size_t)info.st_size;
+      ::madvise(mapping, length, MADV_SEQUENTIAL);
+      return;
+    }
+  }
+
+  // Pipes, terminals and files that cannot be mapped are read into memory.
+  if (!readAll()) {
+    ::close(fd);
+    throw std::runtime_error("File " + path + " could not be read!");
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (mapping != nullptr) {
+    ::munmap(mapping, length);
+  }
+  if (fd >= 0) {
+    ::close(fd);
+  }
+}
+
+bool MappedFile::isOpen() const noexcept { return fd >= 0; }
+
+bool MappedFile::isRegular(const std::string &path) noexcept {
+  struct stat info;
+  return ::stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode);
+}
+
+const char *MappedFile::data() const noexcept {
+  return mapping != nullptr ? static_cast<const char *>(mapping)
+                            : buffer.data();
+}
+
+std::size_t MappedFile::size() const noexcept { return length; }
+
+std::string_view MappedFile::contents() const noexcept {
+  return length == 0 ? std::string_view() : std::string_view(data(), length);
+}
+
+bool MappedFile::readAll() {
+  const std::size_t CHUNK = 1 << 16;
+  for (;;) {
+    buffer.resize(length + CHUNK);
+    const ssize_t count = ::read(fd, buffer.data() + length, CHUNK);
+    if (count < 0 && errno == EINTR) {
+      continue;
+    }
+    if (count < 0) {
+      return false;
+    }
+    if (count == 0) {
+      buffer.resize(length);
+      return true;
+    }
+    length += (std::size_t)count;
+  }
+}
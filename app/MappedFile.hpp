@@ -0,0 +1,50 @@
+#ifndef __MAPPED_FILE__HPP
+#define __MAPPED_FILE__HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// MappedFile
+//
+// Maps a whole file read-only into memory for as long as the object lives,
+// so readers can tokenize the bytes in place instead of copying them through
+// a stream. Pipes, terminals and other files that cannot be mapped are read
+// into a buffer instead, so they load as before, just with one copy.
+class MappedFile {
+public:
+  // Opens and maps `path`. Check isOpen() before using the contents; an empty
+  // file is open but has no bytes. Throws std::runtime_error if the file
+  // opens but cannot be read.
+  explicit MappedFile(const std::string &path);
+
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  bool isOpen() const noexcept;
+
+  // True if `path` names a regular file, which opening never blocks on and
+  // reading never consumes.
+  static bool isRegular(const std::string &path) noexcept;
+
+  const char *data() const noexcept;
+
+  std::size_t size() const noexcept;
+
+  std::string_view contents() const noexcept;
+
+private:
+  int fd;
+  void *mapping;
+  std::size_t length;
+  // The contents when they could not be mapped.
+  std::vector<char> buffer;
+
+  bool readAll();
+};
+
+#endif
@@ -0,0 +1,73 @@
+#include "Coloring.hpp"
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include <vector>
+
+using namespace proj6;
+
+MinimumColoring proj6::minimizeColoring(const CSRGraph &ig,
+                                        const SearchBudget &budget,
+                                        std::uint64_t seed) {
+  const auto start = std::chrono::steady_clock::now();
+  // One scratch for all constructive passes; each one leaves its buckets
+  // and order behind and the next reuses the same memory.
+  ColoringScratch scratch;
+
+  // On a chordal graph the clique of colorChordal is both bounds at once.
+  Coloring chordal;
+  if (colorChordal(ig, scratch, chordal)) {
+    const unsigned num_registers = numRegisters(chordal);
+    return {std::move(chordal), num_registers, num_registers, true};
+  }
+
+  const auto clique = greedyClique(ig);
+  unsigned degeneracy = 0;
+  smallestLastOrder(ig, scratch, &degeneracy);
+  std::reverse(scratch.order.begin(), scratch.order.end());
+  Coloring best;
+  greedyColor(ig, scratch.order, scratch, best);
+
+  Coloring dsatur;
+  colorDsatur(ig, scratch, dsatur);
+  if (numRegisters(dsatur) < numRegisters(best)) {
+    best = std::move(dsatur);
+  }
+
+  MinimumColoring result = {{}, (unsigned)clique.size(),
+                            ig.numVertices() == 0 ? 0 : degeneracy + 1,
+                            false};
+  const auto floor = (Register)clique.size();
+  const bool bounded =
+      budget.time_limit.count() != 0 || budget.node_limit != 0;
+  if (numRegisters(best) > floor && bounded) {
+    // Never round a 1 ms budget down to 0 ms, which would mean no limit. A
+    // node-only budget bounds tabu by its moves alone.
+    SearchBudget tabu_budget = budget;
+    if (budget.time_limit.count() != 0) {
+      tabu_budget.time_limit = std::max(budget.time_limit / 2,
+                                        std::chrono::milliseconds(1));
+    }
+    best = improveTabu(ig, std::move(best), tabu_budget, seed, floor);
+  }
+
+  if (numRegisters(best) > floor) {
+    SearchBudget remaining = budget;
+    if (budget.time_limit.count() != 0) {
+      const auto elapsed =
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::steady_clock::now() - start);
+      // A zero time limit means no limit, so leave at least a millisecond.
+      remaining.time_limit = std::max(budget.time_limit - elapsed,
+                                      std::chrono::milliseconds(1));
+    }
+    ExactColoring exact = colorExact(ig, std::move(best), clique, remaining);
+    best = std::move(exact.colors);
+    result.optimal = exact.optimal;
+  } else {
+    result.optimal = true;
+  }
+
+  result.colors = std::move(best);
+  return result;
+}
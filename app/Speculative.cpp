@@ -0,0 +1,112 @@
+#include "Coloring.hpp"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace proj6;
+
+using VertexId = CSRGraph::VertexId;
+
+Coloring proj6::colorSpeculative(const CSRGraph &ig, ThreadPool &pool,
+                                 ParallelStats *stats) {
+  const unsigned n = ig.numVertices();
+  const unsigned max_degree = ig.maxDegree();
+
+  // Tasks of the same round read each other's registers while they are
+  // being written; relaxed atomics make that well defined and cost nothing
+  // over plain loads and stores.
+  std::unique_ptr<std::atomic<Register>[]> registers(
+      new std::atomic<Register>[n]);
+  for (VertexId v = 0; v < n; v++) {
+    registers[v].store(0, std::memory_order_relaxed);
+  }
+
+  const unsigned num_tasks = 4 * pool.size();
+  auto range = [&](unsigned task, std::size_t size) {
+    return std::make_pair(size * task / num_tasks,
+                          size * (task + 1) / num_tasks);
+  };
+
+  // A vertex can be colored again in a later round, so the marks are
+  // stamped with a per-task counter rather than the vertex ID.
+  std::vector<std::vector<std::size_t>> forbidden(
+      num_tasks, std::vector<std::size_t>(max_degree + 2, 0));
+  std::vector<std::size_t> stamps(num_tasks, 0);
+  std::vector<std::vector<VertexId>> conflicts(num_tasks);
+
+  std::vector<VertexId> pending(n);
+  for (VertexId v = 0; v < n; v++) {
+    pending[v] = v;
+  }
+
+  ParallelStats counts;
+  while (!pending.empty()) {
+    counts.rounds++;
+
+    // Tentative coloring: every task colors its slice of the pending
+    // vertices greedily from whatever registers it can see.
+    pool.parallelFor(num_tasks, [&](unsigned task) {
+      std::vector<std::size_t> &marks = forbidden[task];
+      const auto vertices = range(task, pending.size());
+
+      for (std::size_t i = vertices.first; i < vertices.second; i++) {
+        const VertexId v = pending[i];
+        const std::size_t stamp = ++stamps[task];
+        ig.forEachNeighbor(v, [&](VertexId w) {
+          marks[registers[w].load(std::memory_order_relaxed)] = stamp;
+        });
+
+        Register reg = 1;
+        while (marks[reg] == stamp) {
+          reg++;
+        }
+        registers[v].store(reg, std::memory_order_relaxed);
+      }
+    });
+
+    // Conflict detection: of two neighbors that ended up with the same
+    // register, the one with the larger ID is colored again next round.
+    // The smallest pending vertex never loses, so every round makes
+    // progress.
+    pool.parallelFor(num_tasks, [&](unsigned task) {
+      const auto vertices = range(task, pending.size());
+
+      for (std::size_t i = vertices.first; i < vertices.second; i++) {
+        const VertexId v = pending[i];
+        const Register reg = registers[v].load(std::memory_order_relaxed);
+        bool conflict = false;
+        ig.forEachNeighbor(v, [&](VertexId w) {
+          conflict |= w < v &&
+                      registers[w].load(std::memory_order_relaxed) == reg;
+        });
+        if (conflict) {
+          conflicts[task].push_back(v);
+        }
+      }
+    });
+
+    // Tasks own ascending slices, so the next round stays in ID order.
+    pending.clear();
+    for (auto &vertices : conflicts) {
+      pending.insert(pending.end(), vertices.begin(), vertices.end());
+      vertices.clear();
+    }
+    counts.conflicts += pending.size();
+  }
+
+  if (stats != nullptr) {
+    *stats = counts;
+  }
+
+  Coloring colors(n);
+  for (VertexId v = 0; v < n; v++) {
+    colors[v] = registers[v].load(std::memory_order_relaxed);
+  }
+  return colors;
+}
+
+Coloring proj6::colorSpeculative(const CSRGraph &ig, unsigned num_threads,
+                                 ParallelStats *stats) {
+  ThreadPool pool(num_threads);
+  return colorSpeculative(ig, pool, stats);
+}
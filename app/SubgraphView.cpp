@@ -0,0 +1,46 @@
+#include "SubgraphView.hpp"
+
+SubgraphView::SubgraphView(const CSRGraph &graph)
+    : base(graph), active((graph.numVertices() + 63) / 64, ~std::uint64_t(0)),
+      live_degree(graph.numVertices()), num_active(graph.numVertices()),
+      num_edges(graph.numEdges()) {
+  for (VertexId v = 0; v < graph.numVertices(); v++) {
+    live_degree[v] = graph.degree(v);
+  }
+}
+
+const CSRGraph &SubgraphView::graph() const noexcept { return base; }
+
+bool SubgraphView::isActive(VertexId v) const noexcept {
+  return (active[v / 64] >> (v % 64)) & 1;
+}
+
+unsigned SubgraphView::numActive() const noexcept { return num_active; }
+
+unsigned SubgraphView::numEdges() const noexcept { return num_edges; }
+
+unsigned SubgraphView::degree(VertexId v) const noexcept {
+  return live_degree[v];
+}
+
+bool SubgraphView::deactivate(VertexId v) noexcept {
+  if (!isActive(v)) {
+    return false;
+  }
+  active[v / 64] &= ~(std::uint64_t(1) << (v % 64));
+  num_active--;
+  num_edges -= live_degree[v];
+  base.forEachNeighbor(v, [&](VertexId w) { live_degree[w]--; });
+  return true;
+}
+
+bool SubgraphView::activate(VertexId v) noexcept {
+  if (isActive(v)) {
+    return false;
+  }
+  active[v / 64] |= std::uint64_t(1) << (v % 64);
+  num_active++;
+  num_edges += live_degree[v];
+  base.forEachNeighbor(v, [&](VertexId w) { live_degree[w]++; });
+  return true;
+}
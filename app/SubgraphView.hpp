@@ -0,0 +1,66 @@
+#ifndef __SUBGRAPH_VIEW__HPP
+#define __SUBGRAPH_VIEW__HPP
+
+#include "CSRGraph.hpp"
+#include <cstdint>
+#include <vector>
+
+// SubgraphView
+//
+// The subgraph of a CSRGraph induced by a set of active vertices, kept as
+// a bitmask over the base graph instead of a copy. The view maintains the
+// live degree of every vertex, its number of active neighbors, so
+// deactivating a vertex (the "remove" of simplify, peeling or coloring one
+// class at a time) costs O(degree) and never touches the base graph.
+//
+// The base graph is immutable, so any number of views, each with its own
+// active set, can be used over one graph at the same time, and the graph
+// stays intact for whatever comes after the pass. It must outlive them.
+class SubgraphView {
+public:
+  using VertexId = CSRGraph::VertexId;
+
+  // A view with every vertex of `graph` active.
+  explicit SubgraphView(const CSRGraph &graph);
+
+  const CSRGraph &graph() const noexcept;
+
+  bool isActive(VertexId v) const noexcept;
+
+  unsigned numActive() const noexcept;
+
+  // Edges between active vertices.
+  unsigned numEdges() const noexcept;
+
+  // Number of active neighbors of `v`, whether or not `v` is active.
+  unsigned degree(VertexId v) const noexcept;
+
+  // Makes `v` inactive and lowers its neighbors' live degrees. Returns
+  // false, changing nothing, if it already was.
+  bool deactivate(VertexId v) noexcept;
+
+  // Makes `v` active again. Returns false, changing nothing, if it already
+  // was.
+  bool activate(VertexId v) noexcept;
+
+  // Calls `visit` with every active neighbor of `v` in ascending order.
+  template <typename F> void forEachNeighbor(VertexId v, F &&visit) const;
+
+private:
+  const CSRGraph &base;
+  std::vector<std::uint64_t> active;
+  std::vector<unsigned> live_degree;
+  unsigned num_active;
+  unsigned num_edges;
+};
+
+template <typename F>
+void SubgraphView::forEachNeighbor(VertexId v, F &&visit) const {
+  base.forEachNeighbor(v, [&](VertexId w) {
+    if (isActive(w)) {
+      visit(w);
+    }
+  });
+}
+
+#endif
@@ -0,0 +1,41 @@
+#include "SymbolTable.hpp"
+
+SymbolTable::SymbolTable() : names({}), symbols({}) {}
+
+Symbol SymbolTable::intern(std::string_view name) {
+  auto entry = symbols.find(name);
+
+  if (entry != symbols.end()) {
+    return entry->second;
+  }
+
+  const auto symbol = (Symbol)names.size();
+  names.emplace_back(name);
+  symbols.emplace(names.back(), symbol);
+  return symbol;
+}
+
+Symbol SymbolTable::find(std::string_view name) const noexcept {
+  auto entry = symbols.find(name);
+  return entry == symbols.end() ? NO_SYMBOL : entry->second;
+}
+
+const Variable &SymbolTable::name(Symbol symbol) const noexcept {
+  return names[symbol];
+}
+
+unsigned SymbolTable::size() const noexcept { return (unsigned)names.size(); }
+
+RegisterAssignment
+SymbolTable::resolve(const SymbolAssignment &assignment) const {
+  RegisterAssignment resolved = {};
+  resolved.reserve(assignment.size());
+
+  for (Symbol symbol = 0; symbol < assignment.size(); symbol++) {
+    if (assignment[symbol] != 0) {
+      resolved.insert({names[symbol], assignment[symbol]});
+    }
+  }
+
+  return resolved;
+}
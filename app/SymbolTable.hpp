@@ -0,0 +1,49 @@
+#ifndef __SYMBOL_TABLE__HPP
+#define __SYMBOL_TABLE__HPP
+
+#include "proj6.hpp"
+#include <deque>
+#include <string_view>
+#include <unordered_map>
+
+using namespace proj6;
+
+// SymbolTable
+//
+// Interns variable names as dense 32-bit symbols: the i-th distinct name
+// passed to intern() becomes symbol i. Graphs and allocators work on symbols
+// so that each name is hashed once at load time and copied only when results
+// are turned back into a RegisterAssignment.
+class SymbolTable {
+public:
+  static constexpr Symbol NO_SYMBOL = ~Symbol(0);
+
+  SymbolTable();
+
+  // Names are stored in the table, so the map keys can view them.
+  SymbolTable(const SymbolTable &) = delete;
+
+  SymbolTable &operator=(const SymbolTable &) = delete;
+
+  // Returns the symbol for `name`, adding it if it is new.
+  Symbol intern(std::string_view name);
+
+  // Returns the symbol for `name`, or NO_SYMBOL if it was never interned.
+  Symbol find(std::string_view name) const noexcept;
+
+  const Variable &name(Symbol symbol) const noexcept;
+
+  unsigned size() const noexcept;
+
+  // Converts an assignment indexed by symbol into one keyed by name.
+  // Symbols mapped to register 0 are left out.
+  RegisterAssignment resolve(const SymbolAssignment &assignment) const;
+
+private:
+  // A deque never relocates its elements, so the views in `symbols` stay
+  // valid as names are added.
+  std::deque<Variable> names;
+  std::unordered_map<std::string_view, Symbol> symbols;
+};
+
+#endif
@@ -0,0 +1,210 @@
+#include "Coloring.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace proj6;
+
+using VertexId = CSRGraph::VertexId;
+
+namespace {
+
+// TabuCol (Hertz and de Werra, with the tenure of Galinier and Hao) for a
+// coloring with registers [1, k] that may have conflicts.
+//
+// count(v, r) is the number of neighbors of v holding register r, so moving
+// v to r changes the total number of conflicting edges by
+// count(v, r) - count(v, colors[v]). The matrix is updated in
+// O(degree) per move and only vertices that are in a conflict are ever
+// moved; they are kept in an indexed set.
+class TabuSearch {
+public:
+  TabuSearch(const CSRGraph &ig, Register k, std::mt19937_64 &random)
+      : ig(ig), n(ig.numVertices()), k(k), random(random),
+        neighbor_count((std::size_t)n * (k + 1), 0),
+        tabu_until((std::size_t)n * (k + 1), 0), position(n, NOT_CONFLICTED),
+        num_conflicts(0), fewest_conflicts(0) {}
+
+  // Starts from `colors`, moving every vertex above register k to its least
+  // conflicting register, and searches for a proper coloring. Returns
+  // false if `moves_left` or the clock ran out first.
+  bool run(Coloring &colors, unsigned long &moves_left,
+           const std::chrono::steady_clock::time_point *deadline) {
+    for (VertexId v = 0; v < n; v++) {
+      if (colors[v] <= k) {
+        place(v, colors[v], colors);
+      }
+    }
+    for (VertexId v = 0; v < n; v++) {
+      if (colors[v] > k) {
+        Register best = 1;
+        for (Register reg = 2; reg <= k; reg++) {
+          if (count(v, reg) < count(v, best)) {
+            best = reg;
+          }
+        }
+        place(v, best, colors);
+      }
+    }
+    for (VertexId v = 0; v < n; v++) {
+      updateConflicted(v, colors);
+    }
+    fewest_conflicts = num_conflicts;
+
+    for (unsigned long iteration = 1; num_conflicts > 0; iteration++) {
+      if (moves_left == 0) {
+        return false;
+      }
+      moves_left--;
+      if (deadline != nullptr && iteration % 64 == 0 &&
+          std::chrono::steady_clock::now() >= *deadline) {
+        return false;
+      }
+
+      // Best non-tabu move among conflicting vertices, ties broken at
+      // random; a tabu move is allowed if it reaches fewer conflicts than
+      // ever seen (aspiration).
+      VertexId move_vertex = n;
+      Register move_register = 0;
+      long best_delta = 0;
+      unsigned ties = 0;
+      for (const VertexId v : conflicted) {
+        const unsigned current = count(v, colors[v]);
+        for (Register reg = 1; reg <= k; reg++) {
+          if (reg == colors[v]) {
+            continue;
+          }
+          const long delta = (long)count(v, reg) - (long)current;
+          const bool allowed =
+              tabu_until[index(v, reg)] < iteration ||
+              (long)num_conflicts + delta < (long)fewest_conflicts;
+          if (!allowed || (move_vertex != n && delta > best_delta)) {
+            continue;
+          }
+          if (move_vertex == n || delta < best_delta) {
+            ties = 0;
+          }
+          if (random() % ++ties == 0) {
+            move_vertex = v;
+            move_register = reg;
+            best_delta = delta;
+          }
+        }
+      }
+
+      if (move_vertex == n) {
+        // With a single register there is nowhere to move, and a conflict
+        // never goes away; only a caller's floor of 1 gets here.
+        if (k < 2) {
+          return false;
+        }
+        // Everything is tabu; move a random conflicting vertex anywhere.
+        move_vertex = conflicted[random() % conflicted.size()];
+        move_register = (Register)(random() % (unsigned)(k - 1)) + 1;
+        if (move_register >= colors[move_vertex]) {
+          move_register++;
+        }
+      }
+
+      const Register old = colors[move_vertex];
+      move(move_vertex, move_register, colors);
+      fewest_conflicts = std::min(fewest_conflicts, num_conflicts);
+      tabu_until[index(move_vertex, old)] =
+          iteration + 6 * conflicted.size() / 10 + random() % 10;
+    }
+    return true;
+  }
+
+private:
+  static constexpr unsigned NOT_CONFLICTED = ~0u;
+
+  const CSRGraph &ig;
+  const unsigned n;
+  const Register k;
+  std::mt19937_64 &random;
+
+  std::vector<unsigned> neighbor_count;
+  std::vector<unsigned long> tabu_until;
+  // Vertices with at least one conflict, and where each one sits in it.
+  std::vector<VertexId> conflicted;
+  std::vector<unsigned> position;
+  // Conflicting edges.
+  unsigned long num_conflicts;
+  unsigned long fewest_conflicts;
+
+  std::size_t index(VertexId v, Register reg) const noexcept {
+    return (std::size_t)v * (k + 1) + reg;
+  }
+
+  unsigned count(VertexId v, Register reg) const noexcept {
+    return neighbor_count[index(v, reg)];
+  }
+
+  // Gives the uncolored vertex v register `reg`.
+  void place(VertexId v, Register reg, Coloring &colors) {
+    colors[v] = reg;
+    num_conflicts += count(v, reg);
+    ig.forEachNeighbor(v, [&](VertexId w) { neighbor_count[index(w, reg)]++; });
+  }
+
+  void move(VertexId v, Register reg, Coloring &colors) {
+    const Register old = colors[v];
+    num_conflicts += count(v, reg);
+    num_conflicts -= count(v, old);
+    colors[v] = reg;
+    ig.forEachNeighbor(v, [&](VertexId w) {
+      neighbor_count[index(w, old)]--;
+      neighbor_count[index(w, reg)]++;
+      if (colors[w] == old || colors[w] == reg) {
+        updateConflicted(w, colors);
+      }
+    });
+    updateConflicted(v, colors);
+  }
+
+  void updateConflicted(VertexId v, const Coloring &colors) {
+    const bool in_conflict = count(v, colors[v]) > 0;
+    if (in_conflict && position[v] == NOT_CONFLICTED) {
+      position[v] = (unsigned)conflicted.size();
+      conflicted.push_back(v);
+    } else if (!in_conflict && position[v] != NOT_CONFLICTED) {
+      position[conflicted.back()] = position[v];
+      conflicted[position[v]] = conflicted.back();
+      conflicted.pop_back();
+      position[v] = NOT_CONFLICTED;
+    }
+  }
+};
+
+}; // namespace
+
+Coloring proj6::improveTabu(const CSRGraph &ig, Coloring colors,
+                            const SearchBudget &budget, std::uint64_t seed) {
+  // No k below the size of a clique can work, so never search for one.
+  const auto floor = (Register)greedyClique(ig).size();
+  return improveTabu(ig, std::move(colors), budget, seed, floor);
+}
+
+Coloring proj6::improveTabu(const CSRGraph &ig, Coloring colors,
+                            const SearchBudget &budget, std::uint64_t seed,
+                            Register floor) {
+  const auto deadline = std::chrono::steady_clock::now() + budget.time_limit;
+  unsigned long moves_left =
+      budget.node_limit == 0 ? ~0ul : budget.node_limit;
+  std::mt19937_64 random(seed);
+
+  for (Register k = numRegisters(colors) - 1; k >= floor && k >= 1; k--) {
+    Coloring candidate = colors;
+    TabuSearch search(ig, k, random);
+    if (!search.run(candidate, moves_left,
+                    budget.time_limit.count() == 0 ? nullptr : &deadline)) {
+      break;
+    }
+    colors = std::move(candidate);
+  }
+
+  return colors;
+}
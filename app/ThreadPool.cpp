@@ -0,0 +1,99 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned num_threads)
+    : workers(), task(nullptr), task_count(0), next_task(0), generation(0),
+      busy_workers(0), stopping(false), error(nullptr), error_task(0) {
+  if (num_threads == 0) {
+    num_threads = hardwareThreads();
+  }
+
+  for (unsigned i = 1; i < num_threads; i++) {
+    workers.emplace_back([this] { workerLoop(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  wake.notify_all();
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+unsigned ThreadPool::size() const noexcept {
+  return (unsigned)workers.size() + 1;
+}
+
+void ThreadPool::parallelFor(unsigned count,
+                             const std::function<void(unsigned)> &task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->task = &task;
+    task_count = count;
+    next_task = 0;
+    error = nullptr;
+    busy_workers = (unsigned)workers.size();
+    generation++;
+  }
+  wake.notify_all();
+
+  runTasks();
+
+  std::unique_lock<std::mutex> lock(mutex);
+  done.wait(lock, [this] { return busy_workers == 0; });
+  this->task = nullptr;
+
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+unsigned ThreadPool::hardwareThreads() noexcept {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void ThreadPool::workerLoop() {
+  unsigned long seen = 0;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      wake.wait(lock, [&] { return stopping || generation != seen; });
+      if (stopping) {
+        return;
+      }
+      seen = generation;
+    }
+
+    runTasks();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (--busy_workers == 0) {
+      done.notify_one();
+    }
+  }
+}
+
+void ThreadPool::runTasks() {
+  while (true) {
+    const unsigned i = next_task++;
+    if (i >= task_count) {
+      return;
+    }
+
+    try {
+      (*task)(i);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (error == nullptr || i < error_task) {
+        error = std::current_exception();
+        error_task = i;
+      }
+    }
+  }
+}
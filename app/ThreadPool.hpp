@@ -0,0 +1,63 @@
+#ifndef __THREAD_POOL__HPP
+#define __THREAD_POOL__HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ThreadPool
+//
+// A fixed set of worker threads for data-parallel loops. parallelFor hands
+// out task indices dynamically, so uneven tasks balance themselves. The
+// calling thread works on tasks too, so a pool of size 1 has no workers and
+// runs everything inline.
+//
+// parallelFor calls must not be nested or made concurrently on one pool.
+class ThreadPool {
+public:
+  // 0 means one thread per hardware thread.
+  explicit ThreadPool(unsigned num_threads = 0);
+
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  // Number of threads that run tasks, including the caller.
+  unsigned size() const noexcept;
+
+  // Runs task(i) for every i in [0, count) and waits for all of them. If any
+  // task throws, the exception of the lowest such i is rethrown once every
+  // task has finished.
+  void parallelFor(unsigned count, const std::function<void(unsigned)> &task);
+
+  // The thread count used for 0.
+  static unsigned hardwareThreads() noexcept;
+
+private:
+  std::vector<std::thread> workers;
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::condition_variable done;
+
+  const std::function<void(unsigned)> *task;
+  unsigned task_count;
+  std::atomic<unsigned> next_task;
+  unsigned long generation;
+  unsigned busy_workers;
+  bool stopping;
+
+  std::exception_ptr error;
+  unsigned error_task;
+
+  void workerLoop();
+
+  void runTasks();
+};
+
+#endif
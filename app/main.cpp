@@ -1 +1,94 @@
-int main() { return 0; }
+#include "CSVReader.hpp"
+#include "Coloring.hpp"
+#include "GraphStatistics.hpp"
+#include "IGBinaryReader.hpp"
+#include "IGBinaryWriter.hpp"
+#include "ThreadPool.hpp"
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <string>
+
+// Usage:
+//
+//   a.out.app convert <graph.csv> <graph.igb>
+//
+// converts a CSV graph file into the binary graph format, which
+// assignRegisters loads without parsing.
+//
+//   a.out.app stats <graph>
+//
+// prints vertex and edge counts and the degree histogram of a CSV or binary
+// graph file in a single streaming pass.
+//
+//   a.out.app bench <graph> [max_threads]
+//
+// times the Jones-Plassmann and speculative allocators on 1, 2, 4, ... up
+// to max_threads threads (default: one per hardware thread) and reports
+// the speedup over one thread.
+
+namespace {
+
+void benchmark(const std::string &path, unsigned max_threads) {
+  SymbolTable symbols;
+  const auto ig = IGBinaryReader::isBinary(path)
+                      ? IGBinaryReader(path).freeze(symbols)
+                      : CSVReader::load(path, symbols).freeze();
+  std::cout << ig.numVertices() << " vertices, " << ig.numEdges()
+            << " edges" << std::endl;
+
+  for (const auto strategy :
+       {Strategy::JonesPlassmann, Strategy::Speculative}) {
+    std::cout << (strategy == Strategy::JonesPlassmann ? "jones-plassmann"
+                                                       : "speculative")
+              << std::endl;
+
+    double single_thread = 0;
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+      ThreadPool pool(threads);
+      ParallelStats stats;
+      const auto start = std::chrono::steady_clock::now();
+      const auto colors =
+          strategy == Strategy::JonesPlassmann
+              ? colorJonesPlassmann(ig, pool, ParallelOptions().seed, &stats)
+              : colorSpeculative(ig, pool, &stats);
+      const std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+
+      if (threads == 1) {
+        single_thread = elapsed.count();
+      }
+      std::cout << "  " << threads << " threads: " << elapsed.count() * 1000
+                << " ms, " << numRegisters(colors) << " registers, "
+                << stats.rounds << " rounds, " << stats.conflicts
+                << " conflicts, speedup " << single_thread / elapsed.count()
+                << std::endl;
+    }
+  }
+}
+
+}; // namespace
+
+int main(int argc, char **argv) {
+  try {
+    if (argc == 4 && std::string(argv[1]) == "convert") {
+      IGBinaryWriter::convert(argv[2], argv[3]);
+    } else if (argc == 3 && std::string(argv[1]) == "stats") {
+      GraphStatistics statistics;
+      if (IGBinaryReader::isBinary(argv[2])) {
+        IGBinaryReader(argv[2]).stream(statistics);
+      } else {
+        CSVEdgeSource(argv[2]).stream(statistics);
+      }
+      statistics.print(std::cout);
+    } else if ((argc == 3 || argc == 4) && std::string(argv[1]) == "bench") {
+      benchmark(argv[2], argc == 4 ? (unsigned)std::stoul(argv[3])
+                                   : ThreadPool::hardwareThreads());
+    }
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -1,14 +1,157 @@
 #include "proj6.hpp"
+#include "Allocator.hpp"
 #include "CSVReader.hpp"
+#include "Coloring.hpp"
+#include "Components.hpp"
+#include "IGBinaryReader.hpp"
 #include "InterferenceGraph.hpp"
+#include "Kernel.hpp"
+#include "SymbolTable.hpp"
+#include "ThreadPool.hpp"
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 using namespace proj6;
 
+namespace {
+
+using VertexId = CSRGraph::VertexId;
+
+// loadGraph
+//
+// Loads the graph at `path`, which is either a CSV graph file or a binary
+// graph file written by IGBinaryWriter, interning its vertices in `symbols`.
+FrozenGraph<Symbol> loadGraph(const std::string &path, SymbolTable &symbols) {
+  if (IGBinaryReader::isBinary(path)) {
+    return IGBinaryReader(path).freeze(symbols);
+  }
+  return CSVReader::load(path, symbols).freeze();
+}
+
+// toAssignment
+//
+// Maps the register of each vertex ID of `ig` back to its variable name.
+RegisterAssignment toAssignment(const FrozenGraph<Symbol> &ig,
+                                const SymbolTable &symbols,
+                                const Coloring &colors) {
+  // Names are only looked at again here, when building the result.
+  SymbolAssignment assignment(symbols.size(), 0);
+  for (VertexId vertex = 0; vertex < ig.numVertices(); vertex++) {
+    assignment[ig.name(vertex)] = colors[vertex];
+  }
+  return symbols.resolve(assignment);
+}
+
+RegisterAssignment toAssignment(const FrozenGraph<Variable> &ig,
+                                const Coloring &colors) {
+  RegisterAssignment assignment;
+  assignment.reserve(ig.numVertices());
+  for (VertexId vertex = 0; vertex < ig.numVertices(); vertex++) {
+    assignment.emplace(ig.name(vertex), colors[vertex]);
+  }
+  return assignment;
+}
+
+// Graphs smaller than this are colored on the calling thread; starting a
+// pool would cost more than it saves.
+const unsigned PARALLEL_MIN_VERTICES = 4096;
+
+// colorCore
+//
+// Colors `ig` into `colors` with the chosen strategy. With a serial
+// strategy, a graph that falls apart into several connected components is
+// colored one component at a time on a thread pool (see colorComponents);
+// one tangled function no longer holds up the rest. Returns whether at
+// most `num_registers` registers were used.
+bool colorCore(const CSRGraph &ig, int num_registers, Strategy strategy,
+               const ParallelOptions &parallel, const TabuOptions &tabu,
+               Coloring &colors) {
+  Components components;
+  if (strategy == Strategy::Dsatur || strategy == Strategy::SmallestLast) {
+    components = connectedComponents(ig);
+  }
+
+  if (components.count() > 1) {
+    ThreadPool pool(ig.numVertices() < PARALLEL_MIN_VERTICES
+                        ? 1
+                        : parallel.num_threads);
+    // Tabu search may still bring an over-limit coloring down, so it needs
+    // every component colored.
+    colors = colorComponents(ig, components, strategy, pool,
+                             tabu.enabled ? std::numeric_limits<Register>::max()
+                                          : num_registers);
+    if (tabu.enabled) {
+      colors = improveTabu(ig, std::move(colors), tabu.budget, tabu.seed);
+    }
+  } else {
+    colors = Allocator(strategy, parallel, tabu).color(ig);
+  }
+
+  return numRegisters(colors) <= num_registers;
+}
+
+// colorWithin
+//
+// Colors `ig` into `colors` with at most `num_registers` registers and
+// returns true, or returns false if that did not work out. Hopeless counts
+// are turned away by rejectRegisters before any coloring is done.
+//
+// Vertices with fewer than num_registers neighbors can always be colored
+// once the rest are, so they are peeled off first (see peelLowDegree) and
+// only the core that remains goes to colorCore. The peeled vertices are
+// then colored back in reverse.
+//
+// When everything peels, the reverse peel order alone would fit, but it is
+// a plain greedy coloring that can use far more registers than the chosen
+// strategy. The whole graph then goes to colorCore instead, and the peel
+// order is only the fallback should the strategy not fit.
+bool colorWithin(const CSRGraph &ig, int num_registers, Strategy strategy,
+                 const ParallelOptions &parallel, const TabuOptions &tabu,
+                 Rejection *rejection, Coloring &colors) {
+  const Rejection rejected = rejectRegisters(ig, num_registers);
+  if (rejection != nullptr) {
+    *rejection = rejected;
+  }
+  if (rejected.bound != Bound::None) {
+    return false;
+  }
+
+  const Kernel kernel =
+      peelLowDegree(ig, num_registers < 0 ? 0 : (unsigned)num_registers);
+  if (kernel.peeled.empty()) {
+    return colorCore(ig, num_registers, strategy, parallel, tabu, colors);
+  }
+  if (kernel.core.empty() &&
+      colorCore(ig, num_registers, strategy, parallel, tabu, colors)) {
+    return true;
+  }
+
+  colors.assign(ig.numVertices(), 0);
+  if (!kernel.core.empty()) {
+    std::vector<VertexId> local_id(ig.numVertices());
+    const CSRGraph core =
+        inducedSubgraph(ig, kernel.core.data(),
+                        (unsigned)kernel.core.size(), local_id);
+    Coloring core_colors;
+    if (!colorCore(core, num_registers, strategy, parallel, tabu,
+                   core_colors)) {
+      return false;
+    }
+    for (unsigned i = 0; i < kernel.core.size(); i++) {
+      colors[kernel.core[i]] = core_colors[i];
+    }
+  }
+  colorPeeled(ig, kernel.peeled, colors);
+  return true;
+}
+
+}; // namespace
+
 // assignRegisters
 //
 // This is where you implement the register allocation algorithm
@@ -17,72 +160,117 @@ using namespace proj6;
 // If num_registers is not enough registers to accomodate the passed in
 // graph you should return an empty map. You MUST use registers in the
 // range [1, num_registers] inclusive.
-RegisterAssignment proj6::assignRegisters(const std::string &path_to_graph,
-                                          int num_registers) noexcept {
-  InterferenceGraph<Variable> ig = CSVReader::load(path_to_graph);
-
-  // TODO: You implement this!
-  std::unordered_map<std::string, int> ans = {};
-  std::vector<std::string> vertices = {};
-
-  unsigned i = 0, j = 0;
-  for (auto vertex : ig.vertices()) {
-    vertices.push_back(vertex);
-    j = i;
-    while (j > 0 && ig.degree(vertices[j]) > ig.degree(vertices[j - 1])) {
-      std::swap(vertices[j], vertices[j - 1]);
-      j--;
-    }
-    i++;
-  }
+//
+// Every strategy (see Coloring.hpp) needs at most d(G) + 1 registers, and
+// tabu search only ever lowers the count. Hopeless register counts are
+// turned away by rejectRegisters before any coloring is done, and the
+// strategy only sees the num_registers-core, or the whole graph when that
+// core is empty (see colorWithin).
+RegisterAssignment
+proj6::assignRegisters(const std::string &path_to_graph, int num_registers,
+                       Strategy strategy, const ParallelOptions &parallel,
+                       const TabuOptions &tabu,
+                       Rejection *rejection) noexcept {
+  SymbolTable symbols;
+  const FrozenGraph<Symbol> ig = loadGraph(path_to_graph, symbols);
 
-  int max_registers = num_registers;
-  int max_degree = 0;
-  for (auto vertex : vertices) {
-    if (ig.degree(vertex) > max_degree) {
-      max_degree = ig.degree(vertex);
-    }
+  Coloring colors;
+  if (!colorWithin(ig, num_registers, strategy, parallel, tabu, rejection,
+                   colors)) {
+    return {};
   }
 
-  max_degree++;
-  if (max_registers > max_degree) {
-    max_registers = max_degree;
-  }
+  return toAssignment(ig, symbols, colors);
+}
 
-  for (unsigned i = 1; i <= max_registers; i++) {
-    std::string first_uncolored = vertices.front();
+RegisterAssignment
+proj6::assignRegisters(const InterferenceGraph<Variable> &ig,
+                       int num_registers, Strategy strategy,
+                       const ParallelOptions &parallel,
+                       const TabuOptions &tabu,
+                       Rejection *rejection) noexcept {
+  return assignRegisters(ig.freeze(), num_registers, strategy, parallel, tabu,
+                         rejection);
+}
 
-    ans.insert({first_uncolored, i});
-    std::vector<std::string> temp = {}, same = {first_uncolored};
+RegisterAssignment
+proj6::assignRegisters(const FrozenGraph<Variable> &ig, int num_registers,
+                       Strategy strategy, const ParallelOptions &parallel,
+                       const TabuOptions &tabu,
+                       Rejection *rejection) noexcept {
+  Coloring colors;
+  if (!colorWithin(ig, num_registers, strategy, parallel, tabu, rejection,
+                   colors)) {
+    return {};
+  }
 
-    for (unsigned j = 1; j < vertices.size(); j++) {
-      std::string vertex = vertices[j];
+  return toAssignment(ig, colors);
+}
 
-      bool interferes = false;
-      for (auto v : same) {
-        if (ig.interferes(v, vertex)) {
-          interferes = true;
-          break;
-        }
-      }
+// allocateWithSpills
+//
+// Colors the graph with Chaitin-Briggs simplify/select in a single pass and
+// reports whatever could not be colored as spilled.
+SpillResult proj6::allocateWithSpills(const std::string &path_to_graph,
+                                      int num_registers,
+                                      const SpillCosts &spill_costs) noexcept {
+  SymbolTable symbols;
+  const FrozenGraph<Symbol> ig = loadGraph(path_to_graph, symbols);
 
-      if (interferes) {
-        temp.push_back(vertex);
-      } else {
-        ans.insert({vertex, i});
-        same.push_back(vertex);
+  std::vector<double> costs;
+  if (!spill_costs.empty()) {
+    costs.assign(ig.numVertices(), 1.0);
+    for (const auto &entry : spill_costs) {
+      const Symbol symbol = symbols.find(entry.first);
+      if (symbol != SymbolTable::NO_SYMBOL) {
+        costs[ig.id(symbol)] = entry.second;
       }
     }
+  }
 
-    for (auto v : same) {
-      ig.removeVertex(v);
-    }
-    vertices = temp;
+  const Coloring colors = colorBriggs(ig, num_registers, costs);
 
-    if (ig.numVertices() == 0) {
-      return ans;
+  SpillResult result = {toAssignment(ig, symbols, colors), {}};
+  for (VertexId vertex = 0; vertex < ig.numVertices(); vertex++) {
+    if (colors[vertex] == 0) {
+      result.spilled.push_back(symbols.name(ig.name(vertex)));
     }
   }
+  return result;
+}
+
+// assignRegistersExact
+//
+// Starts from the DSATUR coloring assignRegisters would return and
+// improves it until it is proven optimal or the budget runs out.
+ExactResult proj6::assignRegistersExact(const std::string &path_to_graph,
+                                        const SearchBudget &budget) noexcept {
+  SymbolTable symbols;
+  const FrozenGraph<Symbol> ig = loadGraph(path_to_graph, symbols);
+
+  const ExactColoring exact = colorExact(ig, budget);
+  return {toAssignment(ig, symbols, exact.colors), numRegisters(exact.colors),
+          exact.optimal};
+}
+
+// minimizeRegisters
+//
+// Everything after the load happens on the frozen graph, so the two
+// overloads differ only in how names are mapped back.
+MinimizeResult proj6::minimizeRegisters(const std::string &path_to_graph,
+                                        const SearchBudget &budget) noexcept {
+  SymbolTable symbols;
+  const FrozenGraph<Symbol> ig = loadGraph(path_to_graph, symbols);
+
+  const MinimumColoring minimum = minimizeColoring(ig, budget);
+  return {toAssignment(ig, symbols, minimum.colors),
+          numRegisters(minimum.colors), (int)minimum.lower_bound,
+          minimum.optimal};
+}
 
-  return {};
+MinimizeResult proj6::minimizeRegisters(const FrozenGraph<Variable> &ig,
+                                        const SearchBudget &budget) noexcept {
+  const MinimumColoring minimum = minimizeColoring(ig, budget);
+  return {toAssignment(ig, minimum.colors), numRegisters(minimum.colors),
+          (int)minimum.lower_bound, minimum.optimal};
 }
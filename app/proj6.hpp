@@ -1,8 +1,14 @@
 #ifndef __PROJ_6__HPP
 #define __PROJ_6__HPP
 
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+template <typename T> class FrozenGraph;
+template <typename T> class InterferenceGraph;
 
 namespace proj6 {
 
@@ -10,8 +16,158 @@ using Variable = std::string;
 using Register = int;
 using RegisterAssignment = std::unordered_map<Variable, Register>;
 
-RegisterAssignment assignRegisters(const std::string &path_to_graph,
-                                   int num_registers) noexcept;
+// Interned variable name; see SymbolTable.
+using Symbol = std::uint32_t;
+// Register of each symbol, indexed by symbol. 0 means unassigned.
+using SymbolAssignment = std::vector<Register>;
+
+// How assignRegisters colors the interference graph.
+enum class Strategy {
+  // Brélaz's DSATUR; usually the fewest registers.
+  Dsatur,
+  // Greedy in smallest-last order; the fastest on one thread.
+  SmallestLast,
+  // Jones-Plassmann parallel greedy; see ParallelOptions.
+  JonesPlassmann,
+  // Gebremedhin-Manne speculative parallel greedy with conflict repair;
+  // see ParallelOptions.
+  Speculative,
+};
+
+// What a parallel strategy did.
+struct ParallelStats {
+  // Synchronized rounds over the thread pool.
+  unsigned rounds = 0;
+  // Vertices that had to be colored again because a neighbor raced them to
+  // the same register. Always 0 for JonesPlassmann.
+  unsigned long conflicts = 0;
+};
+
+// Settings for the parallel strategies.
+struct ParallelOptions {
+  // 0 means one thread per hardware thread.
+  unsigned num_threads = 0;
+  // JonesPlassmann results are reproducible for a given seed.
+  std::uint64_t seed = 0x5eed;
+  // If set, receives the ParallelStats of the run.
+  ParallelStats *stats = nullptr;
+};
+
+// Limits for searches that can take exponential time. 0 means no limit.
+struct SearchBudget {
+  std::chrono::milliseconds time_limit{0};
+  // Search nodes for the exact solver, moves for tabu search.
+  unsigned long node_limit = 0;
+};
+
+// Optional tabu search after the strategy has colored the graph; see
+// improveTabu.
+struct TabuOptions {
+  bool enabled = false;
+  SearchBudget budget = {std::chrono::milliseconds(10), 0};
+  std::uint64_t seed = 0x5eed;
+};
+
+// A lower bound that proves a register count too small; see
+// rejectRegisters.
+enum class Bound {
+  // No bound applied; the graph was colored.
+  None,
+  // Every pair of vertices interferes.
+  CompleteGraph,
+  // More interference edges than any graph colorable with that many
+  // registers can have.
+  EdgeCount,
+  // A clique with more vertices than registers.
+  Clique,
+};
+
+// Why assignRegisters returned an empty assignment without coloring.
+struct Rejection {
+  Bound bound = Bound::None;
+  // Registers the bound proves necessary.
+  int registers_needed = 0;
+};
+
+// If `rejection` is given and a cheap lower bound shows that num_registers
+// cannot work, it receives that bound and the graph is not colored.
+RegisterAssignment
+assignRegisters(const std::string &path_to_graph, int num_registers,
+                Strategy strategy = Strategy::Dsatur,
+                const ParallelOptions &parallel = {},
+                const TabuOptions &tabu = {},
+                Rejection *rejection = nullptr) noexcept;
+
+// Same as above for a graph that is already in memory. To allocate many
+// graphs, or one graph for several register counts, use an Allocator.
+RegisterAssignment
+assignRegisters(const InterferenceGraph<Variable> &ig, int num_registers,
+                Strategy strategy = Strategy::Dsatur,
+                const ParallelOptions &parallel = {},
+                const TabuOptions &tabu = {},
+                Rejection *rejection = nullptr) noexcept;
+
+RegisterAssignment
+assignRegisters(const FrozenGraph<Variable> &ig, int num_registers,
+                Strategy strategy = Strategy::Dsatur,
+                const ParallelOptions &parallel = {},
+                const TabuOptions &tabu = {},
+                Rejection *rejection = nullptr) noexcept;
+
+// Cost of keeping each variable in memory instead of a register. Variables
+// that are not listed cost 1.
+using SpillCosts = std::unordered_map<Variable, double>;
+
+// A register for every variable that got one, plus the variables that must
+// live in memory instead.
+struct SpillResult {
+  RegisterAssignment assignment;
+  std::vector<Variable> spilled;
+};
+
+// Like assignRegisters, but never gives up: when num_registers is not
+// enough, cheap-to-spill variables are left out of the assignment and
+// reported in `spilled` instead (see colorBriggs).
+SpillResult allocateWithSpills(const std::string &path_to_graph,
+                               int num_registers,
+                               const SpillCosts &spill_costs = {}) noexcept;
+
+// The fewest registers found for a graph.
+struct ExactResult {
+  RegisterAssignment assignment;
+  int num_registers;
+  // Whether num_registers is proven to be the minimum.
+  bool optimal;
+};
+
+// Finds the minimum number of registers for the graph by branch and bound
+// (see colorExact). If the budget runs out, returns the best assignment
+// found so far with `optimal` false.
+ExactResult assignRegistersExact(const std::string &path_to_graph,
+                                 const SearchBudget &budget = {}) noexcept;
+
+// The fewest registers found for a graph and the bounds around them.
+struct MinimizeResult {
+  RegisterAssignment assignment;
+  int num_registers;
+  // No assignment uses fewer registers than this.
+  int lower_bound;
+  // Whether num_registers is proven to be the minimum.
+  bool optimal;
+};
+
+// Finds the smallest num_registers for which assignRegisters could succeed,
+// loading the graph once and warm-starting each attempt from the previous
+// one (see minimizeColoring). The budget covers the whole search.
+MinimizeResult
+minimizeRegisters(const std::string &path_to_graph,
+                  const SearchBudget &budget = {std::chrono::milliseconds(100),
+                                                0}) noexcept;
+
+MinimizeResult
+minimizeRegisters(const FrozenGraph<Variable> &ig,
+                  const SearchBudget &budget = {std::chrono::milliseconds(100),
+                                                0}) noexcept;
 
 }; // namespace proj6
 
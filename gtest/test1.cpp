@@ -1,11 +1,24 @@
 #include "CSVReader.hpp"
+#include "GraphStatistics.hpp"
+#include "IGBinaryReader.hpp"
+#include "IGBinaryWriter.hpp"
 #include "IGWriter.hpp"
 #include "InterferenceGraph.hpp"
+#include "SubgraphView.hpp"
+#include "SymbolTable.hpp"
 #include "proj6.hpp"
 #include "verifier.hpp"
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
 #include <string>
+#include <sys/stat.h>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 // Warning: These are *NOT* exhaustive tests.
 // You should consider creating your own unit tests
@@ -15,6 +28,11 @@ namespace {
 
 using namespace proj6;
 
+// Where tests write their scratch files, so runs leave the tree clean.
+std::string tempPath(const std::string &name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
 TEST(RequiredPart1, SimpleAddEdgesAndVertices) {
   const auto &GRAPH = "gtest/graphs/simple.csv";
 
@@ -560,4 +578,544 @@ TEST(AdditionalPart2, Cycle6) {
   EXPECT_TRUE(verifyAllocation(GRAPH, NUM_REGS, allocation));
 }
 
+TEST(FrozenGraph, MatchesInterferenceGraph) {
+  const auto &GRAPH = "gtest/graphs/pub_tests.csv";
+
+  const InterferenceGraph<Variable> &ig = CSVReader::load(GRAPH);
+  const FrozenGraph<Variable> &frozen = ig.freeze();
+
+  EXPECT_EQ(frozen.numVertices(), ig.numVertices());
+  EXPECT_EQ(frozen.numEdges(), ig.numEdges());
+
+  for (CSRGraph::VertexId v = 0; v < frozen.numVertices(); v++) {
+    const auto &name = frozen.name(v);
+    EXPECT_EQ(frozen.id(name), v);
+    EXPECT_EQ(frozen.degree(v), ig.degree(name));
+
+    std::unordered_set<Variable> neighbors;
+    frozen.forEachNeighbor(
+        v, [&](CSRGraph::VertexId w) { neighbors.insert(frozen.name(w)); });
+    EXPECT_EQ(neighbors, ig.neighbors(name));
+  }
+}
+
+TEST(FrozenGraph, Interferes) {
+  InterferenceGraph<std::string> graph;
+
+  graph.addVertex("hello");
+  graph.addVertex("world");
+  graph.addVertex("class");
+  graph.addEdge("hello", "world");
+  graph.addEdge("world", "class");
+
+  const auto frozen = graph.freeze();
+  const auto hello = frozen.id("hello"), world = frozen.id("world"),
+             klass = frozen.id("class");
+
+  EXPECT_TRUE(frozen.interferes(hello, world));
+  EXPECT_TRUE(frozen.interferes(klass, world));
+  EXPECT_FALSE(frozen.interferes(hello, klass));
+  EXPECT_EQ(frozen.maxDegree(), 2);
+  EXPECT_THROW(frozen.id("test"), UnknownVertexException);
+}
+
+TEST(FrozenGraph, DenseLayout) {
+  const auto &GRAPH = "gtest/graphs/complete_6.csv";
+
+  const InterferenceGraph<Variable> &ig = CSVReader::load(GRAPH);
+  const auto &dense = ig.freeze(CSRGraph::Layout::Dense);
+  const auto &sparse = ig.freeze(CSRGraph::Layout::Sparse);
+
+  EXPECT_EQ(dense.layout(), CSRGraph::Layout::Dense);
+  EXPECT_NE(dense.matrix(), nullptr);
+  EXPECT_EQ(sparse.layout(), CSRGraph::Layout::Sparse);
+  EXPECT_EQ(sparse.matrix(), nullptr);
+
+  EXPECT_EQ(dense.numEdges(), 15);
+  EXPECT_EQ(dense.maxDegree(), 5);
+
+  for (CSRGraph::VertexId v = 0; v < dense.numVertices(); v++) {
+    EXPECT_EQ(dense.degree(v), sparse.degree(v));
+    for (CSRGraph::VertexId w = 0; w < dense.numVertices(); w++) {
+      EXPECT_EQ(dense.interferes(v, w), sparse.interferes(v, w));
+    }
+  }
+
+  // Auto compares against the padded matrix BitMatrix really allocates:
+  // each row takes at least a cache line, so small graphs stay sparse.
+  EXPECT_EQ(BitMatrix::bytesFor(100), (100 * 8 + 8) * 8);
+  EXPECT_EQ(CSRGraph::preferredLayout(100, 200), CSRGraph::Layout::Sparse);
+  EXPECT_EQ(CSRGraph::preferredLayout(6, 15), CSRGraph::Layout::Sparse);
+  EXPECT_EQ(CSRGraph::preferredLayout(500, 124750), CSRGraph::Layout::Dense);
+}
+
+TEST(FrozenGraph, BitMatrixRowOperations) {
+  BitMatrix matrix(130);
+
+  matrix.set(0, 1);
+  matrix.set(0, 64);
+  matrix.set(0, 129);
+  matrix.set(1, 64);
+  matrix.set(1, 100);
+
+  EXPECT_TRUE(matrix.test(0, 129));
+  EXPECT_FALSE(matrix.test(1, 129));
+  EXPECT_EQ(matrix.rowCount(0), 3);
+  EXPECT_EQ(matrix.intersectionCount(0, 1), 1);
+
+  std::vector<BitMatrix::Word> out(matrix.wordsPerRow());
+  matrix.uniteRows(0, 1, out.data());
+  EXPECT_EQ(BitMatrix::popcount(out.data(), matrix.wordsPerRow()), 4);
+
+  const BitMatrix copy = matrix;
+  std::vector<unsigned> columns;
+  copy.forEachInRow(0, [&](unsigned column) { columns.push_back(column); });
+  EXPECT_EQ(columns, std::vector<unsigned>({1, 64, 129}));
+}
+
+TEST(SymbolTable, InternIsDense) {
+  SymbolTable symbols;
+
+  EXPECT_EQ(symbols.intern("x"), 0);
+  EXPECT_EQ(symbols.intern("y"), 1);
+  EXPECT_EQ(symbols.intern("x"), 0);
+  EXPECT_EQ(symbols.size(), 2);
+
+  EXPECT_EQ(symbols.find("y"), 1);
+  EXPECT_EQ(symbols.find("z"), SymbolTable::NO_SYMBOL);
+  EXPECT_EQ(symbols.name(1), "y");
+
+  const RegisterAssignment &expected = {{"x", 2}};
+  EXPECT_EQ(symbols.resolve({2, 0}), expected);
+}
+
+TEST(SymbolTable, LoadSymbols) {
+  const auto &GRAPH = "gtest/graphs/simple.csv";
+
+  SymbolTable symbols;
+  const InterferenceGraph<Symbol> &ig = CSVReader::load(GRAPH, symbols);
+
+  EXPECT_EQ(ig.numEdges(), 3);
+  EXPECT_EQ(ig.numVertices(), 3);
+  EXPECT_EQ(symbols.size(), 3);
+
+  const std::unordered_set<Symbol> &expected_neighbors = {symbols.find("y"),
+                                                          symbols.find("z")};
+  EXPECT_EQ(ig.neighbors(symbols.find("x")), expected_neighbors);
+  EXPECT_THROW(ig.degree(42), UnknownVertexException);
+}
+
+TEST(GraphViews, NeighborsViewMatchesNeighbors) {
+  InterferenceGraph<std::string> graph;
+
+  graph.addVertex("hello");
+  graph.addVertex("world");
+  graph.addVertex("class");
+  graph.addEdge("hello", "world");
+  graph.addEdge("hello", "class");
+
+  const auto view = graph.neighborsView("hello");
+  EXPECT_EQ(view.size(), 2);
+  EXPECT_TRUE(view.contains("world"));
+  EXPECT_FALSE(view.contains("hello"));
+  EXPECT_EQ(std::unordered_set<std::string>(view.begin(), view.end()),
+            graph.neighbors("hello"));
+
+  EXPECT_EQ(graph.verticesView().size(), 3);
+  EXPECT_TRUE(graph.neighborsView("class").contains("hello"));
+  EXPECT_THROW(graph.neighborsView("test"), UnknownVertexException);
+}
+
+TEST(GraphViews, ForEachNeighbor) {
+  InterferenceGraph<std::string> graph;
+
+  graph.addVertex("hello");
+  graph.addVertex("world");
+  graph.addVertex("class");
+  graph.addEdge("world", "hello");
+  graph.addEdge("world", "class");
+
+  std::unordered_set<std::string> visited;
+  graph.forEachNeighbor("world",
+                        [&](const std::string &v) { visited.insert(v); });
+
+  EXPECT_EQ(visited, graph.neighbors("world"));
+  EXPECT_THROW(graph.forEachNeighbor("test", [](const std::string &) {}),
+               UnknownVertexException);
+}
+
+TEST(CSVLoader, MatchesReadRow) {
+  const std::string PATH = tempPath("loader_rows.csv");
+  {
+    std::ofstream out(PATH);
+    out << "a,b\n\nc,\n,d\nb,a\ne\r\nf,g";
+  }
+
+  const InterferenceGraph<Variable> &ig = CSVReader::load(PATH);
+
+  const std::unordered_set<Variable> &expected_vertices = {
+      "a", "b", "c", "", "d", "e\r", "f", "g"};
+  EXPECT_EQ(ig.vertices(), expected_vertices);
+  EXPECT_EQ(ig.numEdges(), 3);
+  EXPECT_TRUE(ig.interferes("", "d"));
+  EXPECT_TRUE(ig.interferes("g", "f"));
+  EXPECT_EQ(ig.degree("c"), 0);
+  std::filesystem::remove(PATH);
+}
+
+TEST(CSVLoader, Errors) {
+  const std::string PATH = tempPath("loader_three_cells.csv");
+  {
+    std::ofstream out(PATH);
+    out << "a,b\na,,b\n";
+  }
+
+  EXPECT_THROW(CSVReader::load(PATH), std::runtime_error);
+  EXPECT_THROW(CSVReader::load("gtest/graphs/missing.csv"),
+               std::runtime_error);
+
+  SymbolTable symbols;
+  EXPECT_THROW(CSVReader::load(PATH, symbols), std::runtime_error);
+  std::filesystem::remove(PATH);
+}
+
+TEST(CSVLoader, ReadsPipes) {
+  const std::string PATH = tempPath("loader_pipe.csv");
+  std::filesystem::remove(PATH);
+  ASSERT_EQ(mkfifo(PATH.c_str(), 0600), 0);
+
+  // A pipe cannot be mapped, and peeking at it would eat the graph.
+  EXPECT_FALSE(IGBinaryReader::isBinary(PATH));
+
+  std::thread writer([&] {
+    std::ofstream out(PATH);
+    out << "a,b\nb,c\n";
+  });
+  const InterferenceGraph<Variable> &ig = CSVReader::load(PATH);
+  writer.join();
+  std::filesystem::remove(PATH);
+
+  EXPECT_EQ(ig.numVertices(), 3);
+  EXPECT_EQ(ig.numEdges(), 2);
+  EXPECT_TRUE(ig.interferes("b", "c"));
+}
+
+TEST(CSVLoader, ParallelMatchesSerial) {
+  for (const auto &GRAPH : {"gtest/graphs/pub_tests.csv",
+                            "gtest/graphs/full_stress_test.csv"}) {
+    SymbolTable serial_symbols, parallel_symbols;
+    const InterferenceGraph<Symbol> &serial =
+        CSVReader::load(GRAPH, serial_symbols);
+    const InterferenceGraph<Symbol> &parallel =
+        CSVReader::load(GRAPH, parallel_symbols, 4);
+
+    EXPECT_EQ(parallel.numVertices(), serial.numVertices());
+    EXPECT_EQ(parallel.numEdges(), serial.numEdges());
+    ASSERT_EQ(parallel_symbols.size(), serial_symbols.size());
+
+    for (Symbol v = 0; v < serial_symbols.size(); v++) {
+      EXPECT_EQ(parallel_symbols.name(v), serial_symbols.name(v));
+      EXPECT_EQ(parallel.neighbors(v), serial.neighbors(v));
+    }
+  }
+}
+
+TEST(CSVLoader, ParallelErrors) {
+  const std::string PATH = tempPath("loader_three_cells.csv");
+  {
+    std::ofstream out(PATH);
+    out << "a,b\na,,b\n";
+  }
+
+  SymbolTable symbols;
+  EXPECT_THROW(CSVReader::load(PATH, symbols, 4), std::runtime_error);
+  EXPECT_THROW(CSVReader::load("gtest/graphs/missing.csv", symbols, 4),
+               std::runtime_error);
+  std::filesystem::remove(PATH);
+}
+
+TEST(BinaryGraph, RoundTrip) {
+  const auto &GRAPH = "gtest/graphs/pub_tests.csv";
+  const std::string BINARY = tempPath("pub_tests.igb");
+
+  IGBinaryWriter::convert(GRAPH, BINARY);
+  ASSERT_TRUE(IGBinaryReader::isBinary(BINARY));
+  EXPECT_FALSE(IGBinaryReader::isBinary(GRAPH));
+
+  const InterferenceGraph<Variable> &ig = CSVReader::load(GRAPH);
+  const IGBinaryReader reader(BINARY);
+
+  EXPECT_EQ(reader.numVertices(), ig.numVertices());
+  EXPECT_EQ(reader.numEdges(), ig.numEdges());
+
+  for (CSRGraph::VertexId v = 0; v < reader.numVertices(); v++) {
+    const Variable name(reader.name(v));
+    EXPECT_EQ(reader.degree(v), ig.degree(name));
+    for (auto w = reader.neighborsBegin(v); w != reader.neighborsEnd(v); w++) {
+      EXPECT_TRUE(ig.interferes(name, Variable(reader.name(*w))));
+    }
+  }
+
+  SymbolTable symbols;
+  const FrozenGraph<Symbol> &frozen = reader.freeze(symbols);
+  EXPECT_EQ(frozen.numEdges(), ig.numEdges());
+  EXPECT_EQ(symbols.size(), ig.numVertices());
+
+  const auto &allocation = assignRegisters(BINARY, 5);
+  EXPECT_TRUE(verifyAllocation(GRAPH, 5, allocation));
+  std::filesystem::remove(BINARY);
+}
+
+TEST(BinaryGraph, RejectsOtherFiles) {
+  EXPECT_THROW(IGBinaryReader("gtest/graphs/missing.igb"), std::runtime_error);
+  EXPECT_THROW(IGBinaryReader("gtest/graphs/simple.csv"), std::runtime_error);
+}
+
+TEST(BinaryGraph, RejectsCorruptOffsets) {
+  const std::string BINARY = tempPath("corrupt.igb");
+  IGBinaryWriter::convert("gtest/graphs/cycle_6.csv", BINARY);
+  igbinary::IGBinaryHeader header;
+  header.num_vertices = IGBinaryReader(BINARY).numVertices();
+  header.num_edges = IGBinaryReader(BINARY).numEdges();
+  const unsigned n = header.num_vertices;
+
+  // Overwrites the word at `position` in a fresh copy of the file.
+  const auto corrupt = [&](std::size_t position, auto value) {
+    IGBinaryWriter::convert("gtest/graphs/cycle_6.csv", BINARY);
+    std::fstream file(BINARY, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp((std::streamoff)position);
+    file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  };
+
+  // The last offset no longer covers every edge.
+  corrupt(igbinary::offsetsStart() + n * sizeof(std::uint32_t),
+          std::uint32_t(1000));
+  EXPECT_THROW(IGBinaryReader{BINARY}, std::runtime_error);
+
+  // Offsets that go back down.
+  corrupt(igbinary::offsetsStart() + sizeof(std::uint32_t),
+          std::uint32_t(2 * header.num_edges));
+  EXPECT_THROW(IGBinaryReader{BINARY}, std::runtime_error);
+
+  // A neighbor ID past the last vertex, and a self-loop.
+  corrupt(igbinary::adjacencyStart(header), std::uint32_t(n));
+  EXPECT_THROW(IGBinaryReader{BINARY}, std::runtime_error);
+  corrupt(igbinary::adjacencyStart(header), std::uint32_t(0));
+  EXPECT_THROW(IGBinaryReader{BINARY}, std::runtime_error);
+
+  // A name section so large that the file size would wrap around.
+  corrupt(offsetof(igbinary::IGBinaryHeader, name_bytes), ~std::uint64_t(0));
+  EXPECT_THROW(IGBinaryReader{BINARY}, std::runtime_error);
+
+  std::filesystem::remove(BINARY);
+}
+
+TEST(EdgeSource, StatisticsFromCSV) {
+  const auto &GRAPH = "gtest/graphs/three_reg.csv";
+
+  GraphStatistics statistics;
+  CSVEdgeSource(GRAPH).stream(statistics);
+
+  EXPECT_EQ(statistics.numVertices(), 5);
+  EXPECT_EQ(statistics.numEdgeRows(), 3);
+  EXPECT_EQ(statistics.maxDegree(), 2);
+  EXPECT_EQ(statistics.degreeHistogram(), std::vector<unsigned>({1, 2, 2}));
+}
+
+TEST(EdgeSource, LoadFromBinarySource) {
+  const auto &GRAPH = "gtest/graphs/cycle_6.csv";
+  const std::string BINARY = tempPath("cycle_6.igb");
+
+  IGBinaryWriter::convert(GRAPH, BINARY);
+  IGBinaryReader reader(BINARY);
+
+  SymbolTable symbols;
+  const InterferenceGraph<Symbol> &ig = CSVReader::load(reader, symbols);
+
+  EXPECT_EQ(ig.numVertices(), 6);
+  EXPECT_EQ(ig.numEdges(), 6);
+  EXPECT_TRUE(ig.interferes(symbols.find("a"), symbols.find("f")));
+
+  GraphStatistics statistics;
+  reader.stream(statistics);
+  EXPECT_EQ(statistics.numEdgeRows(), 6);
+  EXPECT_EQ(statistics.degreeHistogram(),
+            std::vector<unsigned>({0, 0, 6}));
+  std::filesystem::remove(BINARY);
+}
+
+TEST(SubgraphView, DeactivateKeepsLiveDegrees) {
+  const auto &ig = CSVReader::load("gtest/graphs/cycle_6.csv").freeze();
+  const auto a = ig.id("a");
+  const auto b = ig.id("b");
+
+  SubgraphView view(ig);
+  EXPECT_EQ(view.numActive(), 6);
+  EXPECT_EQ(view.numEdges(), 6);
+
+  EXPECT_TRUE(view.deactivate(a));
+  EXPECT_FALSE(view.deactivate(a));
+  EXPECT_FALSE(view.isActive(a));
+  EXPECT_EQ(view.numActive(), 5);
+  EXPECT_EQ(view.numEdges(), 4);
+  EXPECT_EQ(view.degree(b), 1);
+  unsigned visited = 0;
+  view.forEachNeighbor(b, [&](CSRGraph::VertexId w) {
+    EXPECT_NE(w, a);
+    visited++;
+  });
+  EXPECT_EQ(visited, 1);
+
+  // Views over one graph are independent, and the graph is untouched.
+  SubgraphView other(ig);
+  EXPECT_TRUE(other.isActive(a));
+  EXPECT_EQ(other.degree(b), 2);
+  EXPECT_EQ(ig.degree(b), 2);
+
+  EXPECT_TRUE(view.activate(a));
+  EXPECT_EQ(view.numEdges(), 6);
+  EXPECT_EQ(view.degree(b), 2);
+}
+
+// Checks the degree index and the counts of `graph` against a scan.
+void expectConsistentDegrees(const InterferenceGraph<std::string> &graph) {
+  unsigned degree_sum = 0, max_degree = 0;
+  unsigned min_degree = graph.numVertices() == 0 ? 0 : ~0u;
+  std::vector<unsigned> histogram;
+  for (const auto &vertex : graph.verticesView()) {
+    const unsigned degree = graph.degree(vertex);
+    degree_sum += degree;
+    max_degree = std::max(max_degree, degree);
+    min_degree = std::min(min_degree, degree);
+    histogram.resize(std::max((unsigned)histogram.size(), degree + 1), 0);
+    histogram[degree]++;
+  }
+
+  EXPECT_EQ(graph.numEdges(), degree_sum / 2);
+  EXPECT_EQ(graph.maxDegree(), max_degree);
+  EXPECT_EQ(graph.minDegree(), min_degree);
+  for (unsigned degree = 0; degree < histogram.size(); degree++) {
+    EXPECT_EQ(graph.numVerticesOfDegree(degree), histogram[degree]);
+    unsigned visited = 0;
+    graph.forEachVertexOfDegree(degree, [&](const std::string &vertex) {
+      EXPECT_EQ(graph.degree(vertex), degree);
+      visited++;
+    });
+    EXPECT_EQ(visited, histogram[degree]);
+  }
+}
+
+TEST(DegreeIndex, RemoveVertexUpdatesEdgeCount) {
+  InterferenceGraph<std::string> graph;
+  for (const auto &vertex : {"a", "b", "c", "d"}) {
+    graph.addVertex(vertex);
+  }
+  graph.addEdge("a", "b");
+  graph.addEdge("a", "c");
+  graph.addEdge("c", "d");
+
+  graph.removeVertex("a");
+  EXPECT_EQ(graph.numEdges(), 1);
+  EXPECT_EQ(graph.maxDegree(), 1);
+  EXPECT_EQ(graph.minDegree(), 0);
+}
+
+TEST(DegreeIndex, StaysConsistentThroughEdits) {
+  InterferenceGraph<std::string> graph =
+      CSVReader::load("gtest/graphs/pub_tests.csv");
+  graph.indexDegrees();
+  EXPECT_TRUE(graph.degreesIndexed());
+  expectConsistentDegrees(graph);
+
+  std::vector<std::string> names(graph.verticesView().begin(),
+                                 graph.verticesView().end());
+  std::sort(names.begin(), names.end());
+  graph.checkpoint();
+  for (unsigned step = 0; step < 200; step++) {
+    const std::string &v = names[(step * 7) % names.size()];
+    const std::string &w = names[(step * 13 + 5) % names.size()];
+    if (!graph.vertices().count(v)) {
+      graph.addVertex(v);
+    } else if (step % 5 == 0) {
+      graph.removeVertex(v);
+    } else if (graph.vertices().count(w) && v != w) {
+      if (graph.interferes(v, w)) {
+        graph.removeEdge(v, w);
+      } else {
+        graph.addEdge(v, w);
+      }
+    }
+    expectConsistentDegrees(graph);
+  }
+
+  graph.rollback();
+  expectConsistentDegrees(graph);
+  const InterferenceGraph<std::string> copy = graph;
+  EXPECT_TRUE(copy.degreesIndexed());
+  expectConsistentDegrees(copy);
+  InterferenceGraph<std::string> moved = std::move(graph);
+  expectConsistentDegrees(moved);
+  EXPECT_TRUE(moved.degreesIndexed());
+  EXPECT_EQ(moved.maxDegree(),
+            CSVReader::load("gtest/graphs/pub_tests.csv").maxDegree());
+
+  moved.indexDegrees(false);
+  expectConsistentDegrees(moved);
+}
+
+TEST(Checkpoint, RollbackRestoresGraph) {
+  InterferenceGraph<std::string> graph =
+      CSVReader::load("gtest/graphs/pub_tests.csv");
+  const InterferenceGraph<std::string> original = graph;
+
+  graph.checkpoint();
+  const auto removed = *graph.verticesView().begin();
+  graph.removeVertex(removed);
+  graph.addVertex("spill");
+  graph.addEdge("spill", *graph.verticesView().begin());
+  graph.removeVertex("spill");
+  graph.addVertex(removed);
+  EXPECT_EQ(graph.degree(removed), 0);
+
+  graph.rollback();
+  EXPECT_EQ(graph.numCheckpoints(), 0);
+  EXPECT_EQ(graph.vertices(), original.vertices());
+  EXPECT_EQ(graph.numEdges(), original.numEdges());
+  for (const auto &vertex : original.verticesView()) {
+    EXPECT_EQ(graph.neighbors(vertex), original.neighbors(vertex)) << vertex;
+  }
+}
+
+TEST(Checkpoint, NestedCommitAndRollback) {
+  InterferenceGraph<std::string> graph;
+  graph.addVertex("a");
+  graph.addVertex("b");
+  graph.addVertex("c");
+  graph.addEdge("a", "b");
+
+  graph.checkpoint();
+  graph.addEdge("b", "c");
+  graph.checkpoint();
+  graph.removeEdge("a", "b");
+  graph.commit();
+  EXPECT_EQ(graph.numCheckpoints(), 1);
+  EXPECT_FALSE(graph.interferes("a", "b"));
+  EXPECT_EQ(graph.numEdges(), 1);
+
+  graph.checkpoint();
+  graph.removeEdge("b", "c");
+  graph.rollback();
+  EXPECT_TRUE(graph.interferes("b", "c"));
+  EXPECT_EQ(graph.numEdges(), 1);
+
+  // The committed inner change goes with the outer checkpoint.
+  graph.rollback();
+  EXPECT_TRUE(graph.interferes("a", "b"));
+  EXPECT_FALSE(graph.interferes("b", "c"));
+  EXPECT_EQ(graph.numEdges(), 1);
+
+  EXPECT_THROW(graph.rollback(), std::runtime_error);
+  EXPECT_THROW(graph.commit(), std::runtime_error);
+}
+
 } // end namespace
@@ -0,0 +1,868 @@
+#include "Allocator.hpp"
+#include "CSVReader.hpp"
+#include "Coloring.hpp"
+#include "Components.hpp"
+#include "IncrementalAllocator.hpp"
+#include "InterferenceGraph.hpp"
+#include "Kernel.hpp"
+#include "SymbolTable.hpp"
+#include "ThreadPool.hpp"
+#include "proj6.hpp"
+#include "verifier.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Tests for the register allocation engines. The graphs are loaded the way
+// assignRegisters loads them and each coloring is checked edge by edge.
+
+namespace {
+
+using namespace proj6;
+
+FrozenGraph<Symbol> loadFrozen(const std::string &path) {
+  SymbolTable symbols;
+  return CSVReader::load(path, symbols).freeze();
+}
+
+bool isProper(const CSRGraph &ig, const Coloring &colors) {
+  for (CSRGraph::VertexId v = 0; v < ig.numVertices(); v++) {
+    if (colors[v] < 1) {
+      return false;
+    }
+    bool proper = true;
+    ig.forEachNeighbor(v, [&](CSRGraph::VertexId w) {
+      proper = proper && colors[v] != colors[w];
+    });
+    if (!proper) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST(SmallestLast, Degeneracy) {
+  unsigned degeneracy = 0;
+
+  const auto &complete = loadFrozen("gtest/graphs/complete_6.csv");
+  EXPECT_EQ(smallestLastOrder(complete, &degeneracy).size(), 6);
+  EXPECT_EQ(degeneracy, 5);
+
+  const auto &cycle = loadFrozen("gtest/graphs/cycle_6.csv");
+  smallestLastOrder(cycle, &degeneracy);
+  EXPECT_EQ(degeneracy, 2);
+
+  const auto &bipartite = loadFrozen("gtest/graphs/big_bipartite.csv");
+  smallestLastOrder(bipartite, &degeneracy);
+  EXPECT_EQ(degeneracy, 2);
+}
+
+TEST(SmallestLast, ColorsWithinDegeneracyBound) {
+  for (const auto &GRAPH :
+       {"gtest/graphs/pub_tests.csv", "gtest/graphs/cycle_6.csv",
+        "gtest/graphs/big_bipartite.csv", "gtest/graphs/complete_6.csv",
+        "gtest/graphs/full_stress_test.csv"}) {
+    const auto &ig = loadFrozen(GRAPH);
+    unsigned degeneracy = 0;
+    smallestLastOrder(ig, &degeneracy);
+
+    const Coloring &colors = colorSmallestLast(ig);
+    EXPECT_TRUE(isProper(ig, colors)) << GRAPH;
+    EXPECT_LE(numRegisters(colors), (Register)degeneracy + 1) << GRAPH;
+  }
+}
+
+TEST(SmallestLast, AssignRegistersFailsWhenTooFew) {
+  EXPECT_TRUE(assignRegisters("gtest/graphs/complete_6.csv", 5).empty());
+
+  const auto &allocation = assignRegisters("gtest/graphs/complete_6.csv", 6);
+  EXPECT_TRUE(verifyAllocation("gtest/graphs/complete_6.csv", 6, allocation));
+}
+
+TEST(Dsatur, OptimalOnBipartiteAndComplete) {
+  for (const auto &GRAPH :
+       {"gtest/graphs/cycle_6.csv", "gtest/graphs/big_bipartite.csv"}) {
+    const auto &ig = loadFrozen(GRAPH);
+    const Coloring &colors = colorDsatur(ig);
+    EXPECT_TRUE(isProper(ig, colors)) << GRAPH;
+    EXPECT_EQ(numRegisters(colors), 2) << GRAPH;
+  }
+
+  const auto &complete = loadFrozen("gtest/graphs/complete_6.csv");
+  EXPECT_EQ(numRegisters(colorDsatur(complete)), 6);
+}
+
+TEST(Dsatur, WithinMaxDegreeBound) {
+  for (const auto &GRAPH :
+       {"gtest/graphs/pub_tests.csv", "gtest/graphs/three_reg.csv",
+        "gtest/graphs/full_stress_test.csv"}) {
+    const auto &ig = loadFrozen(GRAPH);
+    const Coloring &colors = colorDsatur(ig);
+    EXPECT_TRUE(isProper(ig, colors)) << GRAPH;
+    EXPECT_LE(numRegisters(colors), (Register)ig.maxDegree() + 1) << GRAPH;
+  }
+}
+
+TEST(Dsatur, AssignRegistersStrategies) {
+  const auto &GRAPH = "gtest/graphs/pub_tests.csv";
+
+  for (const auto strategy : {Strategy::Dsatur, Strategy::SmallestLast}) {
+    const auto &allocation = assignRegisters(GRAPH, 5, strategy);
+    EXPECT_TRUE(verifyAllocation(GRAPH, 5, allocation));
+  }
+}
+
+TEST(Chordal, ColorsIntervalGraphsOptimally) {
+  // Live ranges of straight-line code: variable i is live over
+  // [i, i + i % 4], so the graph is an interval graph, and at most three
+  // ranges overlap at any point.
+  const unsigned VARIABLES = 200;
+  InterferenceGraph<Variable> ranges;
+  for (unsigned i = 0; i < VARIABLES; i++) {
+    ranges.addVertex(std::to_string(i));
+  }
+  for (unsigned i = 0; i < VARIABLES; i++) {
+    for (unsigned j = i + 1; j <= i + i % 4 && j < VARIABLES; j++) {
+      ranges.addEdge(std::to_string(i), std::to_string(j));
+    }
+  }
+  const auto &ig = ranges.freeze();
+
+  const auto &order = maximumCardinalityOrder(ig);
+  EXPECT_TRUE(std::is_permutation(order.begin(), order.end(),
+                                  smallestLastOrder(ig).begin()));
+
+  Coloring colors;
+  ASSERT_TRUE(colorChordal(ig, colors));
+  EXPECT_TRUE(isProper(ig, colors));
+  EXPECT_EQ(numRegisters(colors), 3);
+  EXPECT_EQ(numRegisters(colors), greedyClique(ig).size());
+
+  const auto &minimum = minimizeColoring(ig, {});
+  EXPECT_TRUE(minimum.optimal);
+  EXPECT_EQ(minimum.lower_bound, 3);
+  EXPECT_EQ(numRegisters(minimum.colors), 3);
+  EXPECT_FALSE(assignRegisters(ig, 3).empty());
+
+  const auto &complete = loadFrozen("gtest/graphs/complete_6.csv");
+  ASSERT_TRUE(colorChordal(complete, colors));
+  EXPECT_EQ(numRegisters(colors), 6);
+}
+
+TEST(Chordal, RejectsLongCycles) {
+  Coloring colors;
+  EXPECT_FALSE(colorChordal(loadFrozen("gtest/graphs/cycle_6.csv"), colors));
+  EXPECT_FALSE(
+      colorChordal(loadFrozen("gtest/graphs/big_bipartite.csv"), colors));
+
+  // A chord that splits the 6-cycle into two 4-cycles is not enough.
+  InterferenceGraph<Variable> graph;
+  for (unsigned v = 0; v < 6; v++) {
+    graph.addVertex(std::to_string(v));
+  }
+  for (unsigned v = 0; v < 6; v++) {
+    graph.addEdge(std::to_string(v), std::to_string((v + 1) % 6));
+  }
+  graph.addEdge("0", "3");
+  EXPECT_FALSE(colorChordal(graph.freeze(), colors));
+  graph.addEdge("0", "2");
+  graph.addEdge("3", "5");
+  ASSERT_TRUE(colorChordal(graph.freeze(), colors));
+  EXPECT_EQ(numRegisters(colors), 3);
+}
+
+TEST(Briggs, ColorsWithoutSpillsWhenEnoughRegisters) {
+  const auto &GRAPH = "gtest/graphs/pub_tests.csv";
+
+  const auto &result = allocateWithSpills(GRAPH, 5);
+  EXPECT_TRUE(result.spilled.empty());
+  EXPECT_TRUE(verifyAllocation(GRAPH, 5, result.assignment));
+}
+
+TEST(Briggs, SpillsCheapestVariables) {
+  const auto &GRAPH = "gtest/graphs/complete_6.csv";
+
+  // K6 with 4 registers must spill two variables; make 3 and 5 the cheap
+  // ones.
+  const auto &result = allocateWithSpills(GRAPH, 4, {{"3", 0.5}, {"5", 0.1}});
+  EXPECT_EQ(result.assignment.size(), 4);
+  EXPECT_EQ(std::unordered_set<Variable>(result.spilled.begin(),
+                                         result.spilled.end()),
+            std::unordered_set<Variable>({"3", "5"}));
+
+  for (const auto &entry : result.assignment) {
+    EXPECT_GE(entry.second, 1);
+    EXPECT_LE(entry.second, 4);
+  }
+}
+
+TEST(Briggs, OptimisticColoringAvoidsSpills) {
+  // Every vertex of a 6-cycle has degree 2, so with 2 registers simplify
+  // gets stuck immediately, but optimistic select still colors everything.
+  const auto &ig = loadFrozen("gtest/graphs/cycle_6.csv");
+  const Coloring &colors = colorBriggs(ig, 2);
+
+  EXPECT_TRUE(isProper(ig, colors));
+  EXPECT_EQ(numRegisters(colors), 2);
+}
+
+TEST(Briggs, NoRegistersSpillsEverything) {
+  // Isolated vertices with zero spill cost must still order sensibly when
+  // there are no registers at all.
+  InterferenceGraph<Variable> graph;
+  for (const auto &name : {"a", "b", "c", "d"}) {
+    graph.addVertex(name);
+  }
+  graph.addEdge("c", "d");
+  const auto &ig = graph.freeze();
+
+  const Coloring &colors =
+      colorBriggs(ig, 0, std::vector<double>(ig.numVertices(), 0.0));
+  EXPECT_EQ(colors, Coloring(ig.numVertices(), 0));
+}
+
+TEST(JonesPlassmann, DeterministicAcrossThreadCounts) {
+  for (const auto &GRAPH :
+       {"gtest/graphs/pub_tests.csv", "gtest/graphs/full_stress_test.csv"}) {
+    const auto &ig = loadFrozen(GRAPH);
+
+    const Coloring &serial = colorJonesPlassmann(ig, 1, 42);
+    EXPECT_TRUE(isProper(ig, serial)) << GRAPH;
+    EXPECT_LE(numRegisters(serial), (Register)ig.maxDegree() + 1) << GRAPH;
+
+    for (unsigned threads : {2, 3, 8}) {
+      EXPECT_EQ(colorJonesPlassmann(ig, threads, 42), serial) << GRAPH;
+    }
+  }
+}
+
+TEST(JonesPlassmann, MatchesGreedyInPriorityOrder) {
+  const auto &ig = loadFrozen("gtest/graphs/pub_tests.csv");
+  const std::uint64_t SEED = 7;
+
+  std::vector<CSRGraph::VertexId> order;
+  for (CSRGraph::VertexId v = 0; v < ig.numVertices(); v++) {
+    order.push_back(v);
+  }
+  std::sort(order.begin(), order.end(), [&](auto v, auto w) {
+    const auto pv = vertexPriority(SEED, v), pw = vertexPriority(SEED, w);
+    return pv != pw ? pv > pw : v < w;
+  });
+
+  EXPECT_EQ(colorJonesPlassmann(ig, 4, SEED), greedyColor(ig, order));
+}
+
+TEST(JonesPlassmann, AssignRegisters) {
+  const auto &GRAPH = "gtest/graphs/full_stress_test.csv";
+
+  const auto &allocation =
+      assignRegisters(GRAPH, 500, Strategy::JonesPlassmann, {4, 1});
+  EXPECT_TRUE(verifyAllocation(GRAPH, 500, allocation));
+}
+
+TEST(Speculative, ProperWithinMaxDegreeBound) {
+  for (const auto &GRAPH :
+       {"gtest/graphs/pub_tests.csv", "gtest/graphs/full_stress_test.csv"}) {
+    const auto &ig = loadFrozen(GRAPH);
+
+    for (unsigned threads : {1, 2, 8}) {
+      ParallelStats stats;
+      const Coloring &colors = colorSpeculative(ig, threads, &stats);
+      EXPECT_TRUE(isProper(ig, colors)) << GRAPH;
+      EXPECT_LE(numRegisters(colors), (Register)ig.maxDegree() + 1) << GRAPH;
+      EXPECT_GE(stats.rounds, 1u) << GRAPH;
+    }
+  }
+}
+
+TEST(Speculative, SingleThreadIsGreedyWithoutConflicts) {
+  const auto &ig = loadFrozen("gtest/graphs/full_stress_test.csv");
+
+  std::vector<CSRGraph::VertexId> order;
+  for (CSRGraph::VertexId v = 0; v < ig.numVertices(); v++) {
+    order.push_back(v);
+  }
+
+  ParallelStats stats;
+  EXPECT_EQ(colorSpeculative(ig, 1, &stats), greedyColor(ig, order));
+  EXPECT_EQ(stats.rounds, 1u);
+  EXPECT_EQ(stats.conflicts, 0u);
+}
+
+TEST(Speculative, AssignRegisters) {
+  const auto &GRAPH = "gtest/graphs/full_stress_test.csv";
+
+  // Every vertex of K500 has fewer than 500 neighbors, so the whole graph
+  // is peeled, and the engine colors all of it.
+  ParallelStats stats;
+  const auto &allocation =
+      assignRegisters(GRAPH, 500, Strategy::Speculative, {4, 0, &stats});
+  EXPECT_TRUE(verifyAllocation(GRAPH, 500, allocation));
+  EXPECT_GE(stats.rounds, 1u);
+
+  // K50,50 cannot be peeled at 2 registers, and greedy in ID order colors
+  // it with 2.
+  InterferenceGraph<Variable> bipartite;
+  for (unsigned i = 0; i < 50; i++) {
+    bipartite.addVertex("a" + std::to_string(i));
+    bipartite.addVertex("b" + std::to_string(i));
+  }
+  for (unsigned i = 0; i < 50; i++) {
+    for (unsigned j = 0; j < 50; j++) {
+      bipartite.addEdge("a" + std::to_string(i), "b" + std::to_string(j));
+    }
+  }
+  EXPECT_EQ(assignRegisters(bipartite, 2, Strategy::Speculative,
+                            {1, 0, &stats})
+                .size(),
+            100u);
+  EXPECT_EQ(stats.rounds, 1u);
+}
+
+TEST(Exact, ProvesOptimum) {
+  for (const auto &test : std::vector<std::pair<std::string, int>>{
+           {"gtest/graphs/pub_tests.csv", 5},
+           {"gtest/graphs/three_reg.csv", 2},
+           {"gtest/graphs/complete_6.csv", 6},
+           {"gtest/graphs/cycle_6.csv", 2},
+           {"gtest/graphs/big_bipartite.csv", 2},
+           {"gtest/graphs/full_stress_test.csv", 500}}) {
+    const auto &result = assignRegistersExact(test.first);
+    EXPECT_TRUE(result.optimal) << test.first;
+    EXPECT_EQ(result.num_registers, test.second) << test.first;
+    EXPECT_TRUE(verifyAllocation(test.first, test.second, result.assignment))
+        << test.first;
+  }
+}
+
+TEST(Exact, OddCycleNeedsSearch) {
+  // A 5-cycle: the largest clique is an edge, but it needs 3 registers.
+  InterferenceGraph<Variable> cycle;
+  for (const auto &edge : std::vector<std::pair<Variable, Variable>>{
+           {"a", "b"}, {"b", "c"}, {"c", "d"}, {"d", "e"}, {"e", "a"}}) {
+    cycle.addVertex(edge.first);
+    cycle.addVertex(edge.second);
+    cycle.addEdge(edge.first, edge.second);
+  }
+  const auto &ig = cycle.freeze();
+
+  EXPECT_EQ(greedyClique(ig).size(), 2);
+  const auto &exact = colorExact(ig);
+  EXPECT_TRUE(exact.optimal);
+  EXPECT_EQ(exact.lower_bound, 2);
+  EXPECT_EQ(numRegisters(exact.colors), 3);
+  EXPECT_TRUE(isProper(ig, exact.colors));
+}
+
+TEST(Exact, BudgetKeepsBestColoring) {
+  // Mycielski's graph of a 5-cycle (the Grötzsch graph) is triangle-free
+  // but needs 4 registers, so the clique bound can never prove DSATUR's
+  // coloring optimal without searching.
+  InterferenceGraph<Variable> grotzsch;
+  const std::vector<std::pair<Variable, Variable>> edges = {
+      {"0", "1"}, {"1", "2"}, {"2", "3"}, {"3", "4"}, {"4", "0"},
+      {"5", "1"}, {"5", "4"}, {"6", "0"}, {"6", "2"}, {"7", "1"},
+      {"7", "3"}, {"8", "2"}, {"8", "4"}, {"9", "3"}, {"9", "0"},
+      {"z", "5"}, {"z", "6"}, {"z", "7"}, {"z", "8"}, {"z", "9"}};
+  for (const auto &edge : edges) {
+    grotzsch.addVertex(edge.first);
+    grotzsch.addVertex(edge.second);
+    grotzsch.addEdge(edge.first, edge.second);
+  }
+  const auto &ig = grotzsch.freeze();
+
+  const auto &limited = colorExact(ig, {std::chrono::milliseconds(0), 1});
+  EXPECT_FALSE(limited.optimal);
+  EXPECT_TRUE(isProper(ig, limited.colors));
+  EXPECT_EQ(limited.colors, colorDsatur(ig));
+
+  const auto &exact = colorExact(ig);
+  EXPECT_TRUE(exact.optimal);
+  EXPECT_EQ(numRegisters(exact.colors), 4);
+}
+
+TEST(Tabu, ReducesBadGreedyColoring) {
+  // A crown graph: a_i interferes with b_j for i != j. Greedy in the order
+  // a_1, b_1, a_2, b_2, ... gives each pair its own register, but two
+  // registers are enough.
+  const unsigned PAIRS = 8;
+  InterferenceGraph<Variable> crown;
+  for (unsigned i = 0; i < PAIRS; i++) {
+    crown.addVertex("a" + std::to_string(i));
+    crown.addVertex("b" + std::to_string(i));
+  }
+  for (unsigned i = 0; i < PAIRS; i++) {
+    for (unsigned j = 0; j < PAIRS; j++) {
+      if (i != j) {
+        crown.addEdge("a" + std::to_string(i), "b" + std::to_string(j));
+      }
+    }
+  }
+  const auto &ig = crown.freeze();
+
+  std::vector<CSRGraph::VertexId> order;
+  for (unsigned i = 0; i < PAIRS; i++) {
+    order.push_back(ig.id("a" + std::to_string(i)));
+    order.push_back(ig.id("b" + std::to_string(i)));
+  }
+  const Coloring &greedy = greedyColor(ig, order);
+  EXPECT_EQ(numRegisters(greedy), (Register)PAIRS);
+
+  const Coloring &improved =
+      improveTabu(ig, greedy, {std::chrono::milliseconds(0), 100000});
+  EXPECT_TRUE(isProper(ig, improved));
+  EXPECT_EQ(numRegisters(improved), 2);
+}
+
+TEST(Tabu, NeverWorseAndKeepsBudget) {
+  for (const auto &GRAPH :
+       {"gtest/graphs/pub_tests.csv", "gtest/graphs/full_stress_test.csv"}) {
+    const auto &ig = loadFrozen(GRAPH);
+    const Coloring &start = colorJonesPlassmann(ig, 1, 3);
+
+    const Coloring &improved =
+        improveTabu(ig, start, {std::chrono::milliseconds(50), 0});
+    EXPECT_TRUE(isProper(ig, improved)) << GRAPH;
+    EXPECT_LE(numRegisters(improved), numRegisters(start)) << GRAPH;
+  }
+
+  // A floor of 1 lets the search try a single register, where it has no
+  // move to make; it must give up rather than divide by zero.
+  const auto &cycle = loadFrozen("gtest/graphs/cycle_6.csv");
+  const Coloring &two = colorDsatur(cycle);
+  const Coloring &kept =
+      improveTabu(cycle, two, {std::chrono::milliseconds(50), 0}, 1, 1);
+  EXPECT_EQ(kept, two);
+}
+
+TEST(Tabu, AssignRegisters) {
+  const auto &GRAPH = "gtest/graphs/pub_tests.csv";
+
+  TabuOptions tabu;
+  tabu.enabled = true;
+  const auto &allocation =
+      assignRegisters(GRAPH, 5, Strategy::SmallestLast, {}, tabu);
+  EXPECT_TRUE(verifyAllocation(GRAPH, 5, allocation));
+}
+
+TEST(Allocator, InMemoryGraphs) {
+  const auto &GRAPH = "gtest/graphs/pub_tests.csv";
+  const auto &ig = CSVReader::load(GRAPH);
+
+  EXPECT_TRUE(verifyAllocation(GRAPH, 5, assignRegisters(ig, 5)));
+  EXPECT_TRUE(assignRegisters(ig, 4).empty());
+
+  const auto &frozen = ig.freeze();
+  for (const auto strategy : {Strategy::Dsatur, Strategy::SmallestLast,
+                              Strategy::JonesPlassmann}) {
+    EXPECT_TRUE(
+        verifyAllocation(GRAPH, 5, assignRegisters(frozen, 5, strategy)));
+  }
+}
+
+TEST(Allocator, ReusesBuffers) {
+  const auto &large = CSVReader::load("gtest/graphs/full_stress_test.csv")
+                          .freeze();
+  const auto &small = CSVReader::load("gtest/graphs/pub_tests.csv").freeze();
+
+  for (const auto strategy : {Strategy::Dsatur, Strategy::SmallestLast}) {
+    Allocator allocator(strategy);
+    const Register *buffer = allocator.color(large).data();
+
+    // Smaller graphs and repeated runs reuse the same storage.
+    const Coloring &colors = allocator.color(small);
+    EXPECT_EQ(colors.data(), buffer);
+    EXPECT_TRUE(isProper(small, colors));
+    EXPECT_EQ(allocator.color(large).data(), buffer);
+
+    // Probing several register counts on one graph.
+    EXPECT_TRUE(allocator.assign(small, 4).empty());
+    EXPECT_TRUE(verifyAllocation("gtest/graphs/pub_tests.csv", 5,
+                                 allocator.assign(small, 5)));
+  }
+}
+
+TEST(Minimize, FindsSmallestFeasibleRegisterCount) {
+  for (const auto &test : std::vector<std::pair<std::string, int>>{
+           {"gtest/graphs/pub_tests.csv", 5},
+           {"gtest/graphs/three_reg.csv", 2},
+           {"gtest/graphs/complete_6.csv", 6},
+           {"gtest/graphs/big_bipartite.csv", 2},
+           {"gtest/graphs/full_stress_test.csv", 500}}) {
+    const auto &result = minimizeRegisters(test.first);
+    EXPECT_TRUE(result.optimal) << test.first;
+    EXPECT_EQ(result.num_registers, test.second) << test.first;
+    EXPECT_LE(result.lower_bound, result.num_registers) << test.first;
+    EXPECT_TRUE(verifyAllocation(test.first, test.second, result.assignment))
+        << test.first;
+    EXPECT_TRUE(assignRegisters(test.first, test.second - 1).empty())
+        << test.first;
+  }
+}
+
+TEST(Minimize, ReportsBounds) {
+  // A crown graph again: every vertex has degree PAIRS - 1, so the
+  // degeneracy bound is PAIRS, while two registers suffice.
+  const unsigned PAIRS = 6;
+  InterferenceGraph<Variable> crown;
+  for (unsigned i = 0; i < PAIRS; i++) {
+    crown.addVertex("a" + std::to_string(i));
+    crown.addVertex("b" + std::to_string(i));
+  }
+  for (unsigned i = 0; i < PAIRS; i++) {
+    for (unsigned j = 0; j < PAIRS; j++) {
+      if (i != j) {
+        crown.addEdge("a" + std::to_string(i), "b" + std::to_string(j));
+      }
+    }
+  }
+  const auto &ig = crown.freeze();
+
+  const auto &minimum = minimizeColoring(ig, {});
+  EXPECT_TRUE(minimum.optimal);
+  EXPECT_EQ(minimum.lower_bound, 2);
+  EXPECT_EQ(minimum.upper_bound, PAIRS);
+  EXPECT_EQ(numRegisters(minimum.colors), 2);
+  EXPECT_TRUE(isProper(ig, minimum.colors));
+
+  const auto &result = minimizeRegisters(ig);
+  EXPECT_EQ(result.num_registers, 2);
+  EXPECT_EQ(result.assignment.size(), 2 * PAIRS);
+}
+
+TEST(Minimize, TinyBudgetStillBoundsTabu) {
+  // An odd cycle needs more registers than its largest clique, so both tabu
+  // and the exact search run. Halving a 1 ms budget must not leave tabu
+  // without a limit.
+  InterferenceGraph<Variable> cycle;
+  const unsigned LENGTH = 5;
+  for (unsigned i = 0; i < LENGTH; i++) {
+    cycle.addVertex("v" + std::to_string(i));
+  }
+  for (unsigned i = 0; i < LENGTH; i++) {
+    cycle.addEdge("v" + std::to_string(i),
+                  "v" + std::to_string((i + 1) % LENGTH));
+  }
+  const auto &ig = cycle.freeze();
+
+  const auto &minimum = minimizeColoring(ig, {std::chrono::milliseconds(1), 0});
+  EXPECT_EQ(minimum.lower_bound, 2);
+  EXPECT_EQ(numRegisters(minimum.colors), 3);
+  EXPECT_TRUE(isProper(ig, minimum.colors));
+
+  const auto &result = minimizeRegisters(ig, {std::chrono::milliseconds(1), 0});
+  EXPECT_EQ(result.num_registers, 3);
+
+  // A node-only budget bounds tabu by moves and still ends.
+  const auto &by_nodes =
+      minimizeColoring(ig, {std::chrono::milliseconds(0), 1000});
+  EXPECT_EQ(numRegisters(by_nodes.colors), 3);
+  EXPECT_TRUE(by_nodes.optimal);
+}
+
+TEST(Rejection, CheapestBoundTriggers) {
+  Rejection rejection;
+
+  EXPECT_TRUE(assignRegisters("gtest/graphs/complete_6.csv", 5,
+                              Strategy::Dsatur, {}, {}, &rejection)
+                  .empty());
+  EXPECT_EQ(rejection.bound, Bound::CompleteGraph);
+  EXPECT_EQ(rejection.registers_needed, 6);
+
+  EXPECT_TRUE(assignRegisters("gtest/graphs/pub_tests.csv", 4,
+                              Strategy::Dsatur, {}, {}, &rejection)
+                  .empty());
+  EXPECT_EQ(rejection.bound, Bound::Clique);
+  EXPECT_EQ(rejection.registers_needed, 5);
+
+  const auto &allocation = assignRegisters(
+      "gtest/graphs/pub_tests.csv", 5, Strategy::Dsatur, {}, {}, &rejection);
+  EXPECT_TRUE(verifyAllocation("gtest/graphs/pub_tests.csv", 5, allocation));
+  EXPECT_EQ(rejection.bound, Bound::None);
+}
+
+TEST(Rejection, EdgeCount) {
+  // K6 minus one edge: 14 edges, but 4 registers allow at most 13 on six
+  // vertices, and 5 allow 14.
+  InterferenceGraph<Variable> graph;
+  for (unsigned v = 0; v < 6; v++) {
+    graph.addVertex(std::to_string(v));
+  }
+  for (unsigned v = 0; v < 6; v++) {
+    for (unsigned w = v + 1; w < 6; w++) {
+      if (v != 0 || w != 1) {
+        graph.addEdge(std::to_string(v), std::to_string(w));
+      }
+    }
+  }
+  const auto &ig = graph.freeze();
+
+  const Rejection &rejection = rejectRegisters(ig, 4);
+  EXPECT_EQ(rejection.bound, Bound::EdgeCount);
+  EXPECT_EQ(rejection.registers_needed, 5);
+  EXPECT_EQ(rejectRegisters(ig, 5).bound, Bound::None);
+
+  Rejection from_allocator;
+  EXPECT_TRUE(Allocator().assign(ig, 4, &from_allocator).empty());
+  EXPECT_EQ(from_allocator.bound, Bound::EdgeCount);
+}
+
+TEST(Components, FindsAndColorsComponents) {
+  // A triangle, a path of four, a single edge and an isolated vertex.
+  InterferenceGraph<Variable> graph;
+  for (const auto &vertex :
+       {"a", "b", "c", "p", "q", "r", "s", "x", "y", "z"}) {
+    graph.addVertex(vertex);
+  }
+  for (const auto &edge : std::vector<std::pair<Variable, Variable>>{
+           {"a", "b"}, {"b", "c"}, {"c", "a"}, {"p", "q"}, {"q", "r"},
+           {"r", "s"}, {"x", "y"}}) {
+    graph.addEdge(edge.first, edge.second);
+  }
+  const auto &ig = graph.freeze();
+
+  const Components &components = connectedComponents(ig);
+  ASSERT_EQ(components.count(), 4);
+  EXPECT_EQ(components.size(0), 4);
+  EXPECT_EQ(components.size(1), 3);
+  EXPECT_EQ(components.size(2), 2);
+  EXPECT_EQ(components.size(3), 1);
+
+  for (unsigned threads : {1, 4}) {
+    ThreadPool pool(threads);
+    const Coloring &colors =
+        colorComponents(ig, components, Strategy::Dsatur, pool);
+    EXPECT_TRUE(isProper(ig, colors));
+    EXPECT_EQ(numRegisters(colors), 3);
+  }
+}
+
+TEST(Components, AssignRegistersOnManyFunctions) {
+  // 3000 disjoint copies of K3,3, like a module of small functions. Every
+  // variable interferes with three others, so none of them can be peeled
+  // at 2 or 3 registers and the components are colored one by one.
+  InterferenceGraph<Variable> graph;
+  for (unsigned function = 0; function < 3000; function++) {
+    const std::string prefix = std::to_string(function) + "_";
+    for (unsigned i = 0; i < 6; i++) {
+      graph.addVertex(prefix + std::to_string(i));
+    }
+    for (unsigned i = 0; i < 3; i++) {
+      for (unsigned j = 3; j < 6; j++) {
+        graph.addEdge(prefix + std::to_string(i), prefix + std::to_string(j));
+      }
+    }
+  }
+  const auto &ig = graph.freeze();
+
+  for (const auto strategy : {Strategy::Dsatur, Strategy::SmallestLast}) {
+    const auto &allocation = assignRegisters(ig, 2, strategy, {4});
+    ASSERT_EQ(allocation.size(), ig.numVertices());
+    for (CSRGraph::VertexId v = 0; v < ig.numVertices(); v++) {
+      const Register reg = allocation.at(ig.name(v));
+      EXPECT_GE(reg, 1);
+      EXPECT_LE(reg, 2);
+      ig.forEachNeighbor(v, [&](CSRGraph::VertexId w) {
+        EXPECT_NE(reg, allocation.at(ig.name(w)));
+      });
+    }
+    EXPECT_TRUE(assignRegisters(ig, 1, strategy, {4}).empty());
+  }
+}
+
+TEST(Kernel, PeelsBelowRegisterCount) {
+  // K4 on 0-3 with a tail 3-4-5.
+  InterferenceGraph<Variable> graph;
+  for (unsigned v = 0; v < 6; v++) {
+    graph.addVertex(std::to_string(v));
+  }
+  for (unsigned v = 0; v < 4; v++) {
+    for (unsigned w = v + 1; w < 4; w++) {
+      graph.addEdge(std::to_string(v), std::to_string(w));
+    }
+  }
+  graph.addEdge("3", "4");
+  graph.addEdge("4", "5");
+  const auto &ig = graph.freeze();
+  const auto id = [&](const std::string &name) {
+    for (CSRGraph::VertexId v = 0; v < ig.numVertices(); v++) {
+      if (ig.name(v) == name) {
+        return v;
+      }
+    }
+    return ig.numVertices();
+  };
+
+  EXPECT_TRUE(peelLowDegree(ig, 1).peeled.empty());
+  EXPECT_TRUE(peelLowDegree(ig, 4).core.empty());
+
+  const Kernel &kernel = peelLowDegree(ig, 3);
+  EXPECT_EQ(kernel.peeled,
+            (std::vector<CSRGraph::VertexId>{id("5"), id("4")}));
+  std::vector<CSRGraph::VertexId> core = {id("0"), id("1"), id("2"),
+                                          id("3")};
+  std::sort(core.begin(), core.end());
+  EXPECT_EQ(kernel.core, core);
+
+  Coloring colors(ig.numVertices(), 0);
+  for (unsigned i = 0; i < core.size(); i++) {
+    colors[core[i]] = (Register)i + 1;
+  }
+  colorPeeled(ig, kernel.peeled, colors);
+  EXPECT_TRUE(isProper(ig, colors));
+  EXPECT_EQ(numRegisters(colors), 4);
+
+  const auto &allocation = assignRegisters(ig, 4);
+  EXPECT_EQ(allocation.size(), 6u);
+  EXPECT_TRUE(assignRegisters(ig, 3).empty());
+}
+
+TEST(Kernel, EmptyCoreKeepsStrategy) {
+  // A binomial tree numbered in post order. Greedy in ID order, which is
+  // the order fully peeled vertices are colored back in, gives the root of
+  // the order-k tree register k, while any tree needs just 2.
+  const unsigned ORDER = 6;
+  std::vector<std::pair<CSRGraph::VertexId, CSRGraph::VertexId>> edges;
+  CSRGraph::VertexId next = 0;
+  const auto build = [&](const auto &self, unsigned k) -> CSRGraph::VertexId {
+    std::vector<CSRGraph::VertexId> children;
+    for (unsigned i = 1; i < k; i++) {
+      children.push_back(self(self, i));
+    }
+    const CSRGraph::VertexId root = next++;
+    for (const auto child : children) {
+      edges.emplace_back(root, child);
+    }
+    return root;
+  };
+  build(build, ORDER);
+
+  std::vector<std::vector<CSRGraph::VertexId>> neighbors(next);
+  for (const auto &edge : edges) {
+    neighbors[edge.first].push_back(edge.second);
+    neighbors[edge.second].push_back(edge.first);
+  }
+  std::vector<Variable> names;
+  std::vector<unsigned> offsets = {0};
+  std::vector<CSRGraph::VertexId> adjacency;
+  for (CSRGraph::VertexId v = 0; v < next; v++) {
+    std::sort(neighbors[v].begin(), neighbors[v].end());
+    adjacency.insert(adjacency.end(), neighbors[v].begin(),
+                     neighbors[v].end());
+    offsets.push_back((unsigned)adjacency.size());
+    names.push_back("v" + std::to_string(v));
+  }
+  const FrozenGraph<Variable> ig(std::move(names), std::move(offsets),
+                                 std::move(adjacency));
+  ASSERT_TRUE(peelLowDegree(ig, next).core.empty());
+
+  for (const auto strategy : {Strategy::Dsatur, Strategy::SmallestLast}) {
+    const auto &allocation = assignRegisters(ig, (int)next, strategy);
+    ASSERT_EQ(allocation.size(), next);
+    Register most = 0;
+    for (const auto &entry : allocation) {
+      most = std::max(most, entry.second);
+    }
+    EXPECT_EQ(most, 2);
+  }
+}
+
+// Every variable of `ig` has a register in [1, num_registers] that none of
+// its neighbors shares.
+bool isValidAssignment(const InterferenceGraph<Variable> &ig,
+                       int num_registers,
+                       const RegisterAssignment &assignment) {
+  if (assignment.size() != ig.numVertices()) {
+    return false;
+  }
+  for (const auto &vertex : ig.verticesView()) {
+    const auto reg = assignment.find(vertex);
+    if (reg == assignment.end() || reg->second < 1 ||
+        reg->second > num_registers) {
+      return false;
+    }
+    for (const auto &neighbor : ig.neighborsView(vertex)) {
+      if (assignment.at(neighbor) == reg->second) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+TEST(Incremental, RepairsOnlyWhatChanged) {
+  // A long even cycle: two registers, and every edit is far from most of
+  // the graph.
+  const unsigned LENGTH = 2000;
+  InterferenceGraph<Variable> graph;
+  for (unsigned i = 0; i < LENGTH; i++) {
+    graph.addVertex(std::to_string(i));
+  }
+  for (unsigned i = 0; i < LENGTH; i++) {
+    graph.addEdge(std::to_string(i), std::to_string((i + 1) % LENGTH));
+  }
+
+  IncrementalAllocator allocator(graph, 3);
+  EXPECT_TRUE(isValidAssignment(graph, 3, allocator.assignment()));
+
+  // A chord between two variables that share a register, and a new
+  // variable next to two others.
+  std::string v = "0", w = "2";
+  for (unsigned i = 2; allocator.assignment().at(v) !=
+                       allocator.assignment().at(w);
+       i += 2) {
+    w = std::to_string(i);
+  }
+  graph.addEdge(v, w);
+  graph.addVertex("new");
+  graph.addEdge("new", "100");
+  graph.addEdge("new", "101");
+  graph.removeEdge("500", "501");
+  graph.removeVertex("1000");
+
+  EXPECT_TRUE(isValidAssignment(graph, 3, allocator.update()));
+  EXPECT_EQ(allocator.stats().recolored, 2u);
+  EXPECT_EQ(allocator.stats().reallocations, 0u);
+}
+
+TEST(Incremental, KempeSwapBeforeReallocating) {
+  InterferenceGraph<Variable> graph;
+  for (const auto &vertex : {"a", "b", "x", "y"}) {
+    graph.addVertex(vertex);
+  }
+  graph.addEdge("a", "b");
+  graph.addEdge("x", "y");
+
+  IncrementalAllocator allocator(graph, 2);
+  ASSERT_TRUE(isValidAssignment(graph, 2, allocator.assignment()));
+
+  // "v" sees both registers, but swapping the registers of a and b frees
+  // one for it.
+  const auto &assignment = allocator.assignment();
+  const std::string other =
+      assignment.at("x") != assignment.at("a") ? "x" : "y";
+  graph.addVertex("v");
+  graph.addEdge("v", "a");
+  graph.addEdge("v", other);
+  EXPECT_TRUE(isValidAssignment(graph, 2, allocator.update()));
+  EXPECT_EQ(allocator.stats().kempe_swaps, 1u);
+  EXPECT_EQ(allocator.stats().reallocations, 0u);
+
+  // Closing a 5-cycle through a, b, x, y and v leaves nothing to repair
+  // with two registers.
+  const std::string last = other == "x" ? "y" : "x";
+  graph.addEdge("b", last);
+  EXPECT_TRUE(allocator.update().empty());
+  EXPECT_EQ(allocator.stats().reallocations, 1u);
+
+  graph.removeEdge("b", last);
+  EXPECT_TRUE(isValidAssignment(graph, 2, allocator.update()));
+  EXPECT_EQ(allocator.stats().reallocations, 2u);
+}
+
+} // end namespace
@@ -9,68 +9,114 @@
 
 #include "verifier.hpp"
 #include "CSVReader.hpp"
-#include "InterferenceGraph.hpp"
+#include "EdgeSource.hpp"
+#include "SymbolTable.hpp"
+#include <algorithm>
 #include <fstream>
 #include <gtest/gtest.h>
-#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 using namespace proj6;
 
+namespace {
+
+// Checks an allocation while the graph streams past. Each variable is looked
+// up in the mapping once, when it first appears, and edges are checked as
+// they arrive, so the graph itself is never stored.
+class AllocationChecker : public EdgeSink {
+public:
+  SymbolTable variables;
+  std::vector<unsigned> degrees;
+  // Register of each variable, or 0 if the mapping does not contain it.
+  std::vector<Register> registers;
+  std::pair<Symbol, Symbol> conflict;
+  bool has_conflict;
+
+  explicit AllocationChecker(const RegisterAssignment &mapping)
+      : variables(), degrees({}), registers({}), conflict(0, 0),
+        has_conflict(false), mapping(mapping) {}
+
+  void vertex(std::string_view name) override {
+    const Symbol v = variables.intern(name);
+    if (v == degrees.size()) {
+      degrees.push_back(0);
+      auto entry = mapping.find(variables.name(v));
+      registers.push_back(entry == mapping.end() ? 0 : entry->second);
+    }
+  }
+
+  void edge(std::string_view name_v, std::string_view name_w) override {
+    const Symbol v = variables.find(name_v), w = variables.find(name_w);
+    degrees[v]++;
+    degrees[w]++;
+    if (!has_conflict && registers[v] != 0 && registers[v] == registers[w]) {
+      conflict = std::make_pair(v, w);
+      has_conflict = true;
+    }
+  }
+
+private:
+  const RegisterAssignment &mapping;
+};
+
+}; // namespace
+
 testing::AssertionResult verifyAllocation(const std::string &path_to_graph,
                                           int num_registers,
                                           const RegisterAssignment &mapping) {
 
+  // Read the file the way the original verifier did rather than through
+  // CSVEdgeSource: a missing file is an empty graph, and a row with more
+  // than two cells only names variables.
+  AllocationChecker checker(mapping);
   std::string line;
   std::ifstream file_stream(path_to_graph);
-  std::unordered_map<Variable, unsigned> degrees;
-  std::unordered_set<Variable> variables;
-  std::vector<std::pair<Variable, Variable>> interferences;
-
   while (std::getline(file_stream, line)) {
     const auto &row = CSVReader::readRow(line);
-    for (const auto &v: row) {
-      variables.insert(v);
-      if (degrees.find(v) == degrees.end()) {
-        degrees[v] = 0;
-      }
+    for (const auto &v : row) {
+      checker.vertex(v);
     }
     if (row.size() == 2) {
-      degrees[row[0]]++;
-      degrees[row[1]]++;
-      interferences.push_back(std::make_pair(row[0], row[1]));
+      checker.edge(row[0], row[1]);
     }
   }
 
-  for (const auto& v: variables) {
-    if (mapping.find(v) == mapping.end()) {
+  const auto &variables = checker.variables;
+  const auto &registers = checker.registers;
+  for (Symbol v = 0; v < variables.size(); v++) {
+    const auto &name = variables.name(v);
+    if (registers[v] == 0 && mapping.find(name) == mapping.end()) {
       return testing::AssertionFailure()
-             << "Variable " << v
+             << "Variable " << name
              << " did not get mapped to a register!";
     }
 
-    if (mapping.at(v) < 1 || mapping.at(v) > num_registers)
+    if (registers[v] < 1 || registers[v] > num_registers)
       return testing::AssertionFailure()
-             << "Variable " << v << " mapped to register "
-             << mapping.at(v) << " which is out of range [" << 1 << ","
+             << "Variable " << name << " mapped to register "
+             << registers[v] << " which is out of range [" << 1 << ","
              << num_registers << "]";
   }
 
-  for (const auto& interference : interferences) {
-    if (mapping.at(interference.first) == mapping.at(interference.second))
-      return testing::AssertionFailure()
-             << "Variables " << interference.first << " and " << interference.second
-             << " were mapped to the same register: " << mapping.at(interference.first);
+  if (checker.has_conflict) {
+    const auto &interference = checker.conflict;
+    return testing::AssertionFailure()
+           << "Variables " << variables.name(interference.first) << " and "
+           << variables.name(interference.second)
+           << " were mapped to the same register: "
+           << registers[interference.first];
   }
 
-  if (variables.empty()) {
+  if (variables.size() == 0) {
     return testing::AssertionSuccess();
   }
 
   const auto highest_degree =
-      std::max_element(
-          std::begin(degrees), std::end(degrees),
-          [](const auto &p1, const auto &p2) { return p1.second < p2.second; })
-          ->second;
+      *std::max_element(std::begin(checker.degrees), std::end(checker.degrees));
 
   std::unordered_set<Register> unique_registers;
   for (const auto &e : mapping)
@@ -85,4 +131,4 @@ testing::AssertionResult verifyAllocation(const std::string &path_to_graph,
   }
 
   return testing::AssertionSuccess();
-}
\ No newline at end of file
+}